@@ -0,0 +1,47 @@
+#ifndef FUN_BENCH_HPP
+#define FUN_BENCH_HPP
+
+#include <cstddef>
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+
+namespace fun::bench
+{
+    // Number of inputs cycled through by each benchmark, must be a power of 2
+    inline constexpr std::size_t input_count = 1024;
+
+    [[nodiscard]] constexpr std::size_t wrap(std::size_t i) noexcept
+    {
+        return i & (input_count - 1);
+    }
+
+    /**
+     * Generates a deterministic sequence of pseudo-random integers.
+     * The values are only known at runtime, so the optimizer cannot fold the benchmarked calls.
+     *
+     * @param min   The smallest value that can be generated
+     * @param max   The largest value that can be generated
+     * @return      A vector containing input_count integers
+     */
+    [[nodiscard]] inline std::vector<int> random_ints(int min, int max)
+    {
+        std::mt19937 engine{input_count};
+        std::uniform_int_distribution<int> distribution{min, max};
+        std::vector<int> values(input_count);
+        for (auto &value : values)
+            value = distribution(engine);
+        return values;
+    }
+
+    /**
+     * Hides a value from the optimizer, forcing it to be treated as unknown at compile time.
+     */
+    template<typename T>
+    [[nodiscard]] T opaque(T value)
+    {
+        benchmark::DoNotOptimize(value);
+        return value;
+    }
+}
+#endif //FUN_BENCH_HPP
@@ -0,0 +1,101 @@
+#include <fun.hpp>
+#include "bench.hpp"
+
+namespace fun::bench
+{
+    template<std::size_t>
+    using int_param = int;
+
+    template<std::size_t... Indices>
+    constexpr auto make_sum(std::index_sequence<Indices ...>) noexcept
+    {
+        return [](int_param<Indices>... xs) noexcept { return (xs + ... + 0); };
+    }
+
+    template<std::size_t N>
+    inline constexpr auto sum = make_sum(std::make_index_sequence<N>{});
+
+    template<std::size_t I, std::size_t N, typename F>
+    int apply_one_by_one(F const &f, int const *xs)
+    {
+        if constexpr (I + 1 == N)
+            return f(xs[I]);
+        else
+            return apply_one_by_one<I + 1, N>(f(xs[I]), xs);
+    }
+
+    template<typename F, std::size_t... Indices>
+    int apply_all(F const &f, int const *xs, std::index_sequence<Indices ...>)
+    {
+        return f(xs[Indices] ...);
+    }
+
+    // Each iteration reads N consecutive inputs, the input buffer is padded to avoid wrapping mid-call
+    template<std::size_t N>
+    std::vector<int> const &inputs()
+    {
+        static auto const values = [] {
+            auto result = random_ints(-100, 100);
+            result.resize(input_count + N);
+            return result;
+        }();
+        return values;
+    }
+
+    template<std::size_t N>
+    void curry_plain(benchmark::State &state)
+    {
+        int const *xs = inputs<N>().data();
+        auto const f = sum<N>;
+        std::size_t i = 0;
+        for (auto _ : state)
+            benchmark::DoNotOptimize(apply_all(f, xs + wrap(i++), std::make_index_sequence<N>{}));
+    }
+
+    template<std::size_t N>
+    void curry_curried(benchmark::State &state)
+    {
+        int const *xs = inputs<N>().data();
+        auto const f = curry(sum<N>);
+        std::size_t i = 0;
+        for (auto _ : state)
+            benchmark::DoNotOptimize(apply_one_by_one<0, N>(f, xs + wrap(i++)));
+    }
+
+    template<std::size_t N>
+    void curry_uncurried(benchmark::State &state)
+    {
+        int const *xs = inputs<N>().data();
+        auto const f = uncurry(curry(sum<N>));
+        std::size_t i = 0;
+        for (auto _ : state)
+            benchmark::DoNotOptimize(apply_all(f, xs + wrap(i++), std::make_index_sequence<N>{}));
+    }
+
+    BENCHMARK_TEMPLATE(curry_plain, 1);
+    BENCHMARK_TEMPLATE(curry_plain, 2);
+    BENCHMARK_TEMPLATE(curry_plain, 3);
+    BENCHMARK_TEMPLATE(curry_plain, 4);
+    BENCHMARK_TEMPLATE(curry_plain, 5);
+    BENCHMARK_TEMPLATE(curry_plain, 6);
+    BENCHMARK_TEMPLATE(curry_plain, 7);
+    BENCHMARK_TEMPLATE(curry_plain, 8);
+
+    BENCHMARK_TEMPLATE(curry_curried, 1);
+    BENCHMARK_TEMPLATE(curry_curried, 2);
+    BENCHMARK_TEMPLATE(curry_curried, 3);
+    BENCHMARK_TEMPLATE(curry_curried, 4);
+    BENCHMARK_TEMPLATE(curry_curried, 5);
+    BENCHMARK_TEMPLATE(curry_curried, 6);
+    BENCHMARK_TEMPLATE(curry_curried, 7);
+    BENCHMARK_TEMPLATE(curry_curried, 8);
+
+    BENCHMARK_TEMPLATE(curry_uncurried, 1);
+    BENCHMARK_TEMPLATE(curry_uncurried, 2);
+    BENCHMARK_TEMPLATE(curry_uncurried, 3);
+    BENCHMARK_TEMPLATE(curry_uncurried, 4);
+    BENCHMARK_TEMPLATE(curry_uncurried, 5);
+    BENCHMARK_TEMPLATE(curry_uncurried, 6);
+    BENCHMARK_TEMPLATE(curry_uncurried, 7);
+    BENCHMARK_TEMPLATE(curry_uncurried, 8);
+}
@@ -0,0 +1,105 @@
+#include <fun.hpp>
+#include "bench.hpp"
+
+namespace fun::bench
+{
+    // Protocol-like handlers, one per opcode
+    template<std::intmax_t Opcode>
+    int handle(tag<Opcode>, int x) noexcept
+    {
+        return x * static_cast<int>(Opcode) + static_cast<int>(Opcode % 3);
+    }
+
+    inline constexpr int opcode_count = 16;
+
+    int handle_switch(int opcode, int x) noexcept
+    {
+        switch (opcode)
+        {
+            case 0: return handle(tag<0>{}, x);
+            case 1: return handle(tag<1>{}, x);
+            case 2: return handle(tag<2>{}, x);
+            case 3: return handle(tag<3>{}, x);
+            case 4: return handle(tag<4>{}, x);
+            case 5: return handle(tag<5>{}, x);
+            case 6: return handle(tag<6>{}, x);
+            case 7: return handle(tag<7>{}, x);
+            case 8: return handle(tag<8>{}, x);
+            case 9: return handle(tag<9>{}, x);
+            case 10: return handle(tag<10>{}, x);
+            case 11: return handle(tag<11>{}, x);
+            case 12: return handle(tag<12>{}, x);
+            case 13: return handle(tag<13>{}, x);
+            case 14: return handle(tag<14>{}, x);
+            case 15: return handle(tag<15>{}, x);
+            default: return 0;
+        }
+    }
+
+    void dispatch_switch(benchmark::State &state)
+    {
+        auto const opcodes = random_ints(0, opcode_count - 1);
+        auto const xs = random_ints(-100, 100);
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            std::size_t const j = wrap(i++);
+            benchmark::DoNotOptimize(handle_switch(opcodes[j], xs[j]));
+        }
+    }
+
+    void dispatch_fun_dispatch(benchmark::State &state)
+    {
+        auto const opcodes = random_ints(0, opcode_count - 1);
+        auto const xs = random_ints(-100, 100);
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            std::size_t const j = wrap(i++);
+            int const x = xs[j];
+            benchmark::DoNotOptimize(dispatch<0, opcode_count - 1>(
+                opcodes[j],
+                [x](auto opcode) noexcept { return handle(opcode, x); },
+                nullsink<1>([]() noexcept { return 0; })
+            ));
+        }
+    }
+
+    // Pairs of opcodes, as a hand-written nested switch would need 16 * 16 cases
+    void dispatch_fun_dispatch_pair(benchmark::State &state)
+    {
+        auto const firsts = random_ints(0, opcode_count - 1);
+        auto const seconds = random_ints(0, opcode_count - 1);
+        auto const xs = random_ints(-100, 100);
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            std::size_t const j = wrap(i++);
+            int const x = xs[j];
+            benchmark::DoNotOptimize(dispatch<0, opcode_count - 1>(
+                firsts[j],
+                seconds[j],
+                [x](auto first, auto second) noexcept { return handle(first, handle(second, x)); },
+                nullsink<2>([]() noexcept { return 0; })
+            ));
+        }
+    }
+
+    void dispatch_switch_pair(benchmark::State &state)
+    {
+        auto const firsts = random_ints(0, opcode_count - 1);
+        auto const seconds = random_ints(0, opcode_count - 1);
+        auto const xs = random_ints(-100, 100);
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            std::size_t const j = wrap(i++);
+            benchmark::DoNotOptimize(handle_switch(firsts[j], handle_switch(seconds[j], xs[j])));
+        }
+    }
+
+    BENCHMARK(dispatch_switch);
+    BENCHMARK(dispatch_fun_dispatch);
+    BENCHMARK(dispatch_switch_pair);
+    BENCHMARK(dispatch_fun_dispatch_pair);
+}
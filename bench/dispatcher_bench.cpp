@@ -0,0 +1,120 @@
+#include <functional>
+#include <tuple>
+#include <typeindex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <fun.hpp>
+#include "bench.hpp"
+
+namespace fun::bench
+{
+    // Event bus with one message type and one handler for each of them
+    inline constexpr std::size_t event_type_count = 64;
+
+    template<std::size_t I>
+    struct bus_event
+    {
+        int value = static_cast<int>(I);
+    };
+
+    template<std::size_t I>
+    struct bus_handler
+    {
+        int *total;
+
+        void operator()(bus_event<I> const &e) const noexcept
+        {
+            *total += e.value;
+        }
+    };
+
+    template<std::size_t... Is>
+    auto make_bus_events(std::index_sequence<Is ...>)
+    {
+        return std::tuple<bus_event<Is> ...>{};
+    }
+
+    using bus_events = decltype(make_bus_events(std::make_index_sequence<event_type_count>{}));
+
+    // Type-erased references to random events
+    template<typename Erased, typename Erase>
+    std::vector<Erased> random_messages(bus_events const &events, Erase erase)
+    {
+        std::vector<Erased> messages;
+        for (int const kind : random_ints(0, event_type_count - 1))
+        {
+            messages.push_back(detail::visit_index<Erased, event_type_count>(
+                static_cast<std::size_t>(kind),
+                [&]<std::size_t I>() { return erase(std::get<I>(events)); }
+            ));
+        }
+        return messages;
+    }
+
+    void dispatcher_table(benchmark::State &state)
+    {
+        int total = 0;
+        auto const bus = [&]<std::size_t... Is>(std::index_sequence<Is ...>) {
+            return dispatcher{bus_handler<Is>{&total} ...};
+        }(std::make_index_sequence<event_type_count>{});
+
+        bus_events const events;
+        auto const messages = random_messages<message>(events, [](auto const &e) { return message{e}; });
+        std::size_t i = 0;
+        for (auto _ : state)
+            bus(messages[wrap(i++)]);
+        benchmark::DoNotOptimize(total);
+    }
+
+    void dispatcher_type_chain(benchmark::State &state)
+    {
+        int total = 0;
+        auto const bus = [&]<std::size_t... Is>(std::index_sequence<Is ...>) {
+            return [handlers = std::tuple{bus_handler<Is>{&total} ...}](message const &m) {
+                ((m.holds<bus_event<Is>>() && (std::get<Is>(handlers)(*m.get_if<bus_event<Is>>()), true)) || ...);
+            };
+        }(std::make_index_sequence<event_type_count>{});
+
+        bus_events const events;
+        auto const messages = random_messages<message>(events, [](auto const &e) { return message{e}; });
+        std::size_t i = 0;
+        for (auto _ : state)
+            bus(messages[wrap(i++)]);
+        benchmark::DoNotOptimize(total);
+    }
+
+    struct indexed_message
+    {
+        std::type_index type;
+        void const *data;
+    };
+
+    void dispatcher_type_index_map(benchmark::State &state)
+    {
+        int total = 0;
+        std::unordered_map<std::type_index, std::function<void(void const *)>> bus;
+        [&]<std::size_t... Is>(std::index_sequence<Is ...>) {
+            ((bus[typeid(bus_event<Is>)] = [h = bus_handler<Is>{&total}](void const *data) {
+                h(*static_cast<bus_event<Is> const *>(data));
+            }), ...);
+        }(std::make_index_sequence<event_type_count>{});
+
+        bus_events const events;
+        auto const messages = random_messages<indexed_message>(events, []<typename E>(E const &e) {
+            return indexed_message{typeid(E), &e};
+        });
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            auto const &m = messages[wrap(i++)];
+            if (auto const handler = bus.find(m.type); handler != bus.end())
+                handler->second(m.data);
+        }
+        benchmark::DoNotOptimize(total);
+    }
+
+    BENCHMARK(dispatcher_table);
+    BENCHMARK(dispatcher_type_chain);
+    BENCHMARK(dispatcher_type_index_map);
+}
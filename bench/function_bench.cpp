@@ -0,0 +1,143 @@
+#include <functional>
+#include <fun.hpp>
+#include "bench.hpp"
+
+namespace fun::bench
+{
+    int square(int x) noexcept
+    {
+        return x * x;
+    }
+
+    void function_direct(benchmark::State &state)
+    {
+        auto const xs = random_ints(-100, 100);
+        std::size_t i = 0;
+        for (auto _ : state)
+            benchmark::DoNotOptimize(square(xs[wrap(i++)]));
+    }
+
+    void function_raw_pointer(benchmark::State &state)
+    {
+        auto const xs = random_ints(-100, 100);
+        int (*const f)(int) = opaque(&square);
+        std::size_t i = 0;
+        for (auto _ : state)
+            benchmark::DoNotOptimize(f(xs[wrap(i++)]));
+    }
+
+    void function_std_function(benchmark::State &state)
+    {
+        auto const xs = random_ints(-100, 100);
+        std::function<int(int)> const f = opaque(&square);
+        std::size_t i = 0;
+        for (auto _ : state)
+            benchmark::DoNotOptimize(f(xs[wrap(i++)]));
+    }
+
+    void function_fun_function(benchmark::State &state)
+    {
+        auto const xs = random_ints(-100, 100);
+        fun::function<int(int)> const f = opaque(&square);
+        std::size_t i = 0;
+        for (auto _ : state)
+            benchmark::DoNotOptimize(f(xs[wrap(i++)]));
+    }
+
+    void function_inplace_function(benchmark::State &state)
+    {
+        auto const xs = random_ints(-100, 100);
+        inplace_function<int(int)> const f = opaque(&square);
+        std::size_t i = 0;
+        for (auto _ : state)
+            benchmark::DoNotOptimize(f(xs[wrap(i++)]));
+    }
+
+    void function_std_function_stateful(benchmark::State &state)
+    {
+        auto const xs = random_ints(-100, 100);
+        std::function<int(int)> f = [offset = opaque(1), scale = opaque(2), bias = opaque(3L)](int x) {
+            return static_cast<int>((x + offset) * scale + bias);
+        };
+        std::size_t i = 0;
+        for (auto _ : state)
+            benchmark::DoNotOptimize(f(xs[wrap(i++)]));
+    }
+
+    void function_inplace_function_stateful(benchmark::State &state)
+    {
+        auto const xs = random_ints(-100, 100);
+        inplace_function<int(int)> f = [offset = opaque(1), scale = opaque(2), bias = opaque(3L)](int x) {
+            return static_cast<int>((x + offset) * scale + bias);
+        };
+        std::size_t i = 0;
+        for (auto _ : state)
+            benchmark::DoNotOptimize(f(xs[wrap(i++)]));
+    }
+
+    void function_function_ref(benchmark::State &state)
+    {
+        auto const xs = random_ints(-100, 100);
+        function_ref<int(int)> const f = opaque(&square);
+        std::size_t i = 0;
+        for (auto _ : state)
+            benchmark::DoNotOptimize(f(xs[wrap(i++)]));
+    }
+
+    void function_function_ref_stateful(benchmark::State &state)
+    {
+        auto const xs = random_ints(-100, 100);
+        auto const g = [offset = opaque(1), scale = opaque(2), bias = opaque(3L)](int x) {
+            return static_cast<int>((x + offset) * scale + bias);
+        };
+        function_ref<int(int)> const f = g;
+        std::size_t i = 0;
+        for (auto _ : state)
+            benchmark::DoNotOptimize(f(xs[wrap(i++)]));
+    }
+
+    // Measures construction and destruction, where std::function allocates for large captures
+    void function_std_function_construct(benchmark::State &state)
+    {
+        long const a = opaque(1L), b = opaque(2L), c = opaque(3L);
+        for (auto _ : state)
+        {
+            std::function<long()> f = [a, b, c] { return a + b + c; };
+            benchmark::DoNotOptimize(f);
+        }
+    }
+
+    void function_inplace_function_construct(benchmark::State &state)
+    {
+        long const a = opaque(1L), b = opaque(2L), c = opaque(3L);
+        for (auto _ : state)
+        {
+            inplace_function<long()> f = [a, b, c] { return a + b + c; };
+            benchmark::DoNotOptimize(f);
+        }
+    }
+
+    void function_function_ref_construct(benchmark::State &state)
+    {
+        long const a = opaque(1L), b = opaque(2L), c = opaque(3L);
+        auto const g = [a, b, c] { return a + b + c; };
+        for (auto _ : state)
+        {
+            function_ref<long()> f = g;
+            benchmark::DoNotOptimize(f);
+        }
+    }
+
+    BENCHMARK(function_direct);
+    BENCHMARK(function_raw_pointer);
+    BENCHMARK(function_std_function);
+    BENCHMARK(function_fun_function);
+    BENCHMARK(function_inplace_function);
+    BENCHMARK(function_function_ref);
+    BENCHMARK(function_std_function_stateful);
+    BENCHMARK(function_inplace_function_stateful);
+    BENCHMARK(function_function_ref_stateful);
+    BENCHMARK(function_std_function_construct);
+    BENCHMARK(function_inplace_function_construct);
+    BENCHMARK(function_function_ref_construct);
+}
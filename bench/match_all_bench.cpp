@@ -0,0 +1,96 @@
+#include <variant>
+#include <vector>
+#include <fun.hpp>
+#include "bench.hpp"
+
+namespace fun::bench
+{
+    struct deposit { int amount; };
+    struct withdrawal { int amount; };
+    struct fee { int amount; int rate; };
+    struct audit {};
+
+    using transaction = std::variant<deposit, withdrawal, fee, audit>;
+
+    inline constexpr auto balance_change = overload(
+        [](deposit t) noexcept { return t.amount; },
+        [](withdrawal t) noexcept { return -t.amount; },
+        [](fee t) noexcept { return -t.amount * t.rate / 100; },
+        [](audit) noexcept { return 0; }
+    );
+
+    std::vector<transaction> random_transactions(std::size_t count)
+    {
+        std::mt19937 engine{static_cast<unsigned>(count)};
+        std::uniform_int_distribution<int> kinds{0, std::variant_size_v<transaction> - 1};
+        std::uniform_int_distribution<int> amounts{1, 1000};
+        std::vector<transaction> transactions;
+        transactions.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            switch (kinds(engine))
+            {
+                case 0: transactions.emplace_back(deposit{amounts(engine)}); break;
+                case 1: transactions.emplace_back(withdrawal{amounts(engine)}); break;
+                case 2: transactions.emplace_back(fee{amounts(engine), 3}); break;
+                default: transactions.emplace_back(audit{}); break;
+            }
+        }
+        return transactions;
+    }
+
+    void match_all_per_element(benchmark::State &state)
+    {
+        auto const transactions = random_transactions(static_cast<std::size_t>(state.range(0)));
+        std::vector<int> results(transactions.size());
+        for (auto _ : state)
+        {
+            for (std::size_t i = 0; i < transactions.size(); ++i)
+                results[i] = match(transactions[i], balance_change);
+            benchmark::DoNotOptimize(results.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    template<match_mode Mode>
+    void match_all_bucketed(benchmark::State &state)
+    {
+        auto const transactions = random_transactions(static_cast<std::size_t>(state.range(0)));
+        for (auto _ : state)
+            benchmark::DoNotOptimize(match_all<Mode>(transactions, balance_change));
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    // Summing needs no results, which is where grouping by alternative pays off the most
+    void match_all_sum_per_element(benchmark::State &state)
+    {
+        auto const transactions = random_transactions(static_cast<std::size_t>(state.range(0)));
+        for (auto _ : state)
+        {
+            int sum = 0;
+            for (auto const &t : transactions)
+                sum += match(t, balance_change);
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void match_all_sum_bucketed(benchmark::State &state)
+    {
+        auto const transactions = random_transactions(static_cast<std::size_t>(state.range(0)));
+        for (auto _ : state)
+        {
+            int sum = 0;
+            match_all(transactions, [&](auto const &t) noexcept { sum += balance_change(t); });
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK(match_all_per_element)->Arg(1 << 10)->Arg(1 << 16);
+    BENCHMARK_TEMPLATE(match_all_bucketed, match_mode::unordered)->Arg(1 << 10)->Arg(1 << 16);
+    BENCHMARK_TEMPLATE(match_all_bucketed, match_mode::ordered)->Arg(1 << 10)->Arg(1 << 16);
+    BENCHMARK_TEMPLATE(match_all_bucketed, match_mode::ordered | match_mode::parallel)->Arg(1 << 16)->UseRealTime();
+    BENCHMARK(match_all_sum_per_element)->Arg(1 << 10)->Arg(1 << 16);
+    BENCHMARK(match_all_sum_bucketed)->Arg(1 << 10)->Arg(1 << 16);
+}
@@ -0,0 +1,214 @@
+#include <variant>
+#include <fun.hpp>
+#include "bench.hpp"
+
+namespace fun::bench
+{
+    struct add { int value; };
+    struct sub { int value; };
+    struct mul { int value; };
+    struct neg {};
+
+    using message = std::variant<add, sub, mul, neg>;
+
+    inline constexpr auto handler = overload(
+        [](add m) noexcept { return m.value; },
+        [](sub m) noexcept { return -m.value; },
+        [](mul m) noexcept { return m.value * 3; },
+        [](neg) noexcept { return -1; }
+    );
+
+    std::vector<message> random_messages()
+    {
+        auto const kinds = random_ints(0, std::variant_size_v<message> - 1);
+        auto const values = random_ints(-100, 100);
+        std::vector<message> messages;
+        messages.reserve(input_count);
+        for (std::size_t i = 0; i < input_count; ++i)
+        {
+            switch (kinds[i])
+            {
+                case 0: messages.emplace_back(add{values[i]}); break;
+                case 1: messages.emplace_back(sub{values[i]}); break;
+                case 2: messages.emplace_back(mul{values[i]}); break;
+                default: messages.emplace_back(neg{}); break;
+            }
+        }
+        return messages;
+    }
+
+    int handle_with_switch(message const &m) noexcept
+    {
+        switch (m.index())
+        {
+            case 0: return handler(*std::get_if<0>(&m));
+            case 1: return handler(*std::get_if<1>(&m));
+            case 2: return handler(*std::get_if<2>(&m));
+            default: return handler(*std::get_if<3>(&m));
+        }
+    }
+
+    void match_switch(benchmark::State &state)
+    {
+        auto const messages = random_messages();
+        std::size_t i = 0;
+        for (auto _ : state)
+            benchmark::DoNotOptimize(handle_with_switch(messages[wrap(i++)]));
+    }
+
+    void match_std_visit(benchmark::State &state)
+    {
+        auto const messages = random_messages();
+        std::size_t i = 0;
+        for (auto _ : state)
+            benchmark::DoNotOptimize(std::visit(handler, messages[wrap(i++)]));
+    }
+
+    void match_fun_match(benchmark::State &state)
+    {
+        auto const messages = random_messages();
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(match(
+                messages[wrap(i++)],
+                [](add m) noexcept { return m.value; },
+                [](sub m) noexcept { return -m.value; },
+                [](mul m) noexcept { return m.value * 3; },
+                [](neg) noexcept { return -1; }
+            ));
+        }
+    }
+
+    template<std::size_t I>
+    struct alternative { int value; };
+
+    template<typename Indices>
+    struct sized_message_impl;
+
+    template<std::size_t... Indices>
+    struct sized_message_impl<std::index_sequence<Indices ...>>
+    {
+        using type = std::variant<alternative<Indices> ...>;
+
+        static type make(std::size_t kind, int value)
+        {
+            type result{};
+            ((kind == Indices ? (result = alternative<Indices>{value}, true) : false) || ...);
+            return result;
+        }
+    };
+
+    // Variant with N alternatives, used to compare the switch and table dispatch strategies
+    template<std::size_t N>
+    using sized_message = sized_message_impl<std::make_index_sequence<N>>;
+
+    inline constexpr auto sized_handler = []<std::size_t I>(alternative<I> m) noexcept {
+        return m.value * static_cast<int>(I + 1);
+    };
+
+    template<std::size_t N>
+    std::vector<typename sized_message<N>::type> random_sized_messages()
+    {
+        auto const kinds = random_ints(0, N - 1);
+        auto const values = random_ints(-100, 100);
+        std::vector<typename sized_message<N>::type> messages;
+        messages.reserve(input_count);
+        for (std::size_t i = 0; i < input_count; ++i)
+            messages.push_back(sized_message<N>::make(kinds[i], values[i]));
+        return messages;
+    }
+
+    template<std::size_t N>
+    void match_std_visit_sized(benchmark::State &state)
+    {
+        auto const messages = random_sized_messages<N>();
+        std::size_t i = 0;
+        for (auto _ : state)
+            benchmark::DoNotOptimize(std::visit(sized_handler, messages[wrap(i++)]));
+    }
+
+    template<std::size_t N>
+    void match_fun_match_sized(benchmark::State &state)
+    {
+        auto const messages = random_sized_messages<N>();
+        std::size_t i = 0;
+        for (auto _ : state)
+            benchmark::DoNotOptimize(match(messages[wrap(i++)], sized_handler));
+    }
+
+    using order = std::variant<add, sub>;
+
+    inline constexpr auto pair_handler = overload(
+        [](add o, neg) noexcept { return -o.value; },
+        [](add o, auto m) noexcept { return o.value + m.value; },
+        [](sub o, auto) noexcept { return -o.value; }
+    );
+
+    std::vector<order> random_orders()
+    {
+        auto const kinds = random_ints(0, 1);
+        auto const values = random_ints(-100, 100);
+        std::vector<order> orders;
+        orders.reserve(input_count);
+        for (std::size_t i = 0; i < input_count; ++i)
+            orders.push_back(kinds[i] ? order{sub{values[i]}} : order{add{values[i]}});
+        return orders;
+    }
+
+    void match_pair_std_visit(benchmark::State &state)
+    {
+        auto const orders = random_orders();
+        auto const messages = random_messages();
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(std::visit(pair_handler, orders[wrap(i)], messages[wrap(i)]));
+            ++i;
+        }
+    }
+
+    void match_pair_nested(benchmark::State &state)
+    {
+        auto const orders = random_orders();
+        auto const messages = random_messages();
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(match(orders[wrap(i)], [&](auto o) noexcept {
+                return match(messages[wrap(i)], [&](auto m) noexcept { return pair_handler(o, m); });
+            }));
+            ++i;
+        }
+    }
+
+    void match_pair_flattened(benchmark::State &state)
+    {
+        auto const orders = random_orders();
+        auto const messages = random_messages();
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(match(orders[wrap(i)], messages[wrap(i)], pair_handler));
+            ++i;
+        }
+    }
+
+    BENCHMARK(match_switch);
+    BENCHMARK(match_std_visit);
+    BENCHMARK(match_fun_match);
+
+    BENCHMARK(match_pair_std_visit);
+    BENCHMARK(match_pair_nested);
+    BENCHMARK(match_pair_flattened);
+
+    BENCHMARK_TEMPLATE(match_std_visit_sized, 2);
+    BENCHMARK_TEMPLATE(match_std_visit_sized, 8);
+    BENCHMARK_TEMPLATE(match_std_visit_sized, 16);
+    BENCHMARK_TEMPLATE(match_std_visit_sized, 32);
+
+    BENCHMARK_TEMPLATE(match_fun_match_sized, 2);
+    BENCHMARK_TEMPLATE(match_fun_match_sized, 8);
+    BENCHMARK_TEMPLATE(match_fun_match_sized, 16);
+    BENCHMARK_TEMPLATE(match_fun_match_sized, 32);
+}
@@ -0,0 +1,92 @@
+#include <array>
+#include <chrono>
+#include <fun.hpp>
+#include "bench.hpp"
+
+namespace fun::bench
+{
+    // Number of classes whose member pointers are registered, each with its own instantiation
+    inline constexpr std::size_t startup_class_count = 256;
+
+    template<std::size_t I>
+    struct startup_record
+    {
+        int id = static_cast<int>(I);
+        double weight = 1.0;
+    };
+
+    template<std::size_t I>
+    using startup_pointers = member_pointers<&startup_record<I>::id, &startup_record<I>::weight>;
+
+    template<std::size_t I>
+    constexpr std::size_t describe_record(int startup_record<I>::*id, double startup_record<I>::*weight) noexcept
+    {
+        startup_record<I> const record{};
+        return static_cast<std::size_t>(record.*id) + static_cast<std::size_t>(record.*weight);
+    }
+
+    // Only constant-initialized state is touched by the initializers, which run in an unspecified order
+    inline std::array<std::size_t, startup_class_count> dynamic_registry{};
+    inline std::size_t dynamic_registrations = 0;
+    inline std::chrono::steady_clock::time_point first_registration{};
+    inline std::chrono::steady_clock::time_point last_registration{};
+
+    template<std::size_t I>
+    void register_record(int startup_record<I>::*id, double startup_record<I>::*weight)
+    {
+        if (dynamic_registrations == 0)
+            first_registration = std::chrono::steady_clock::now();
+        dynamic_registry[I] = describe_record<I>(id, weight);
+        if (++dynamic_registrations == startup_class_count)
+            last_registration = std::chrono::steady_clock::now();
+    }
+
+    // Taking the addresses instantiates one dynamic initializer per class
+    inline constexpr auto dynamic_initializers = []<std::size_t... I>(std::index_sequence<I ...>) {
+        return std::array{
+            static_cast<void const *>(&startup_pointers<I>::template access<&register_record<I>>::_) ...
+        };
+    }(std::make_index_sequence<startup_class_count>{});
+
+    // The same registry built from the pointer lists at compile time
+    inline constexpr auto constant_registry = []<std::size_t... I>(std::index_sequence<I ...>) {
+        return std::array{startup_pointers<I>::apply(describe_record<I>) ...};
+    }(std::make_index_sequence<startup_class_count>{});
+
+    // Replays the work done by each dynamic initializer before main
+    inline constexpr auto replay_initializers = []<std::size_t... I>(std::index_sequence<I ...>) {
+        return std::array<void (*)(), startup_class_count>{
+            [] { startup_pointers<I>::apply(register_record<I>); } ...
+        };
+    }(std::make_index_sequence<startup_class_count>{});
+
+    void member_pointers_dynamic_init(benchmark::State &state)
+    {
+        if (dynamic_registry != constant_registry)
+            state.SkipWithError("registries differ");
+
+        auto const startup = std::chrono::duration<double, std::nano>{last_registration - first_registration};
+        for (auto _ : state)
+        {
+            for (auto const initializer : replay_initializers)
+                initializer();
+            benchmark::DoNotOptimize(dynamic_registry);
+        }
+        state.counters["startup_ns"] = startup.count();
+        state.counters["initializers"] = static_cast<double>(dynamic_initializers.size());
+    }
+
+    // The registry is constant-initialized, so there is no startup work to time
+    void member_pointers_constexpr(benchmark::State &state)
+    {
+        for (auto _ : state)
+        {
+            auto registry = constant_registry;
+            benchmark::DoNotOptimize(registry);
+        }
+        state.counters["initializers"] = 0;
+    }
+
+    BENCHMARK(member_pointers_dynamic_init);
+    BENCHMARK(member_pointers_constexpr);
+}
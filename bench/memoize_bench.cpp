@@ -0,0 +1,78 @@
+#include <mutex>
+#include <unordered_map>
+#include <fun.hpp>
+#include "bench.hpp"
+
+namespace fun::bench
+{
+    // Number of steps needed to reach 1 in the Collatz sequence, expensive enough to be worth caching
+    int collatz_steps(int x) noexcept
+    {
+        long long n = x;
+        int steps = 0;
+        while (n > 1)
+        {
+            n = (n % 2 == 0) ? n / 2 : 3 * n + 1;
+            ++steps;
+        }
+        return steps;
+    }
+
+    // Hand-written baseline: a single map guarded by a single mutex
+    class locked_cache
+    {
+        std::mutex _mutex;
+        std::unordered_map<int, int> _results;
+
+    public:
+        int operator()(int x)
+        {
+            std::scoped_lock lock{_mutex};
+            if (auto it = _results.find(x); it != _results.end())
+                return it->second;
+            return _results.emplace(x, collatz_steps(x)).first->second;
+        }
+    };
+
+    auto const memoize_inputs = random_ints(1, 1 << 20);
+
+    void memoize_direct(benchmark::State &state)
+    {
+        std::size_t i = 0;
+        for (auto _ : state)
+            benchmark::DoNotOptimize(collatz_steps(memoize_inputs[wrap(i++)]));
+    }
+
+    void memoize_locked_map(benchmark::State &state)
+    {
+        static locked_cache f{};
+        std::size_t i = 0;
+        for (auto _ : state)
+            benchmark::DoNotOptimize(f(memoize_inputs[wrap(i++)]));
+    }
+
+    template<std::size_t Shards>
+    void memoize_fun_memoize(benchmark::State &state)
+    {
+        static auto const f = memoize<Shards>(&collatz_steps);
+        std::size_t i = 0;
+        for (auto _ : state)
+            benchmark::DoNotOptimize(f(memoize_inputs[wrap(i++)]));
+    }
+
+    void memoize_fun_memoize_bounded(benchmark::State &state)
+    {
+        // Only half of the inputs fit, so evictions happen continuously
+        static auto const f = memoize(&collatz_steps, input_count / 2);
+        std::size_t i = 0;
+        for (auto _ : state)
+            benchmark::DoNotOptimize(f(memoize_inputs[wrap(i++)]));
+    }
+
+    BENCHMARK(memoize_direct)->ThreadRange(1, 8);
+    BENCHMARK(memoize_locked_map)->ThreadRange(1, 8);
+    BENCHMARK_TEMPLATE(memoize_fun_memoize, 1)->ThreadRange(1, 8);
+    BENCHMARK_TEMPLATE(memoize_fun_memoize, 16)->ThreadRange(1, 8);
+    BENCHMARK_TEMPLATE(memoize_fun_memoize, 64)->ThreadRange(1, 8);
+    BENCHMARK(memoize_fun_memoize_bounded)->ThreadRange(1, 8);
+}
@@ -0,0 +1,49 @@
+#include <fun.hpp>
+#include "bench.hpp"
+
+namespace fun::bench
+{
+    int twice(int x) noexcept
+    {
+        return x * 2;
+    }
+
+    double halve(double x) noexcept
+    {
+        return x / 2;
+    }
+
+    void overload_direct(benchmark::State &state)
+    {
+        auto const xs = random_ints(-100, 100);
+        auto const f = [](int x) noexcept { return x * 2; };
+        std::size_t i = 0;
+        for (auto _ : state)
+            benchmark::DoNotOptimize(f(xs[wrap(i++)]));
+    }
+
+    void overload_lambdas(benchmark::State &state)
+    {
+        auto const xs = random_ints(-100, 100);
+        auto const f = overload(
+            [](int x) noexcept { return x * 2; },
+            [](double x) noexcept { return x / 2; }
+        );
+        std::size_t i = 0;
+        for (auto _ : state)
+            benchmark::DoNotOptimize(f(xs[wrap(i++)]));
+    }
+
+    void overload_function_pointers(benchmark::State &state)
+    {
+        auto const xs = random_ints(-100, 100);
+        auto const f = overload(opaque(&twice), opaque(&halve));
+        std::size_t i = 0;
+        for (auto _ : state)
+            benchmark::DoNotOptimize(f(xs[wrap(i++)]));
+    }
+
+    BENCHMARK(overload_direct);
+    BENCHMARK(overload_lambdas);
+    BENCHMARK(overload_function_pointers);
+}
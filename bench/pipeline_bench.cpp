@@ -0,0 +1,101 @@
+#include <iterator>
+#include <ranges>
+#include <vector>
+#include <fun.hpp>
+#include "bench.hpp"
+
+namespace fun::bench
+{
+    constexpr int scale(int x) noexcept
+    {
+        return 3 * x + 1;
+    }
+
+    constexpr bool is_small(int x) noexcept
+    {
+        return x < 1500;
+    }
+
+    // Each benchmark runs once with the function pointer wrappers and once with lambdas
+    inline constexpr transform<int> scale_transform{scale};
+    inline constexpr predicate<int> small_predicate{is_small};
+    inline constexpr auto scale_lambda = [](int x) noexcept { return scale(x); };
+    inline constexpr auto small_lambda = [](int x) noexcept { return is_small(x); };
+
+    template<typename F, typename P>
+    void pipeline_views(benchmark::State &state, F f, P p)
+    {
+        auto const xs = random_ints(0, 1000);
+        for (auto _ : state)
+        {
+            int sum = 0;
+            for (int const x : xs | std::views::transform(f) | std::views::filter(p))
+                sum += x;
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * xs.size()));
+    }
+
+    template<typename F, typename P>
+    void pipeline_fused(benchmark::State &state, F f, P p)
+    {
+        auto const xs = random_ints(0, 1000);
+        for (auto _ : state)
+            benchmark::DoNotOptimize(xs | map(f) | filter(p) | fold(0, std::plus<>{}));
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * xs.size()));
+    }
+
+    template<typename F, typename P>
+    void pipeline_chunked(benchmark::State &state, F f, P p)
+    {
+        auto const xs = random_ints(0, 1000);
+        for (auto _ : state)
+            benchmark::DoNotOptimize(xs | chunked<256> | map(f) | filter(p) | fold(0, std::plus<>{}));
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * xs.size()));
+    }
+
+    // Appending to a vector cannot be vectorized, which leaves the whole fused loop scalar
+    inline constexpr auto polynomial = [](int x) noexcept {
+        float const y = static_cast<float>(x) * 0.001f;
+        return ((0.5f * y + 0.25f) * y + 0.125f) * y + 1.0f;
+    };
+
+    template<std::size_t ChunkSize>
+    void pipeline_collect(benchmark::State &state)
+    {
+        auto const xs = random_ints(0, 1000);
+        std::vector<float> out;
+        out.reserve(xs.size());
+        for (auto _ : state)
+        {
+            out.clear();
+            xs | chunked<ChunkSize> | map(polynomial) | map(polynomial) | into(std::back_inserter(out));
+            benchmark::DoNotOptimize(out.data());
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * xs.size()));
+    }
+
+    void pipeline_collect_fused(benchmark::State &state)
+    {
+        auto const xs = random_ints(0, 1000);
+        std::vector<float> out;
+        out.reserve(xs.size());
+        for (auto _ : state)
+        {
+            out.clear();
+            xs | map(polynomial) | map(polynomial) | into(std::back_inserter(out));
+            benchmark::DoNotOptimize(out.data());
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * xs.size()));
+    }
+
+    BENCHMARK_CAPTURE(pipeline_views, function, scale_transform, small_predicate);
+    BENCHMARK_CAPTURE(pipeline_fused, function, scale_transform, small_predicate);
+    BENCHMARK_CAPTURE(pipeline_chunked, function, scale_transform, small_predicate);
+    BENCHMARK_CAPTURE(pipeline_views, lambda, scale_lambda, small_lambda);
+    BENCHMARK_CAPTURE(pipeline_fused, lambda, scale_lambda, small_lambda);
+    BENCHMARK_CAPTURE(pipeline_chunked, lambda, scale_lambda, small_lambda);
+    BENCHMARK(pipeline_collect_fused);
+    BENCHMARK_TEMPLATE(pipeline_collect, 64);
+    BENCHMARK_TEMPLATE(pipeline_collect, 256);
+}
@@ -0,0 +1,109 @@
+#include <memory>
+#include <variant>
+#include <vector>
+#include <fun.hpp>
+#include "bench.hpp"
+
+namespace fun::bench
+{
+    struct small_circle { float radius; };
+    struct small_square { float side; };
+    struct large_polygon { float sides[8]; };
+
+    inline constexpr auto shape_area = overload(
+        [](small_circle const &c) noexcept { return 3.14159f * c.radius * c.radius; },
+        [](small_square const &s) noexcept { return s.side * s.side; },
+        [](large_polygon const &p) noexcept { return p.sides[0] * p.sides[1]; }
+    );
+
+    struct shape_base
+    {
+        virtual ~shape_base() = default;
+        [[nodiscard]] virtual float area() const noexcept = 0;
+    };
+
+    template<typename Shape>
+    struct shape_impl final : shape_base
+    {
+        Shape shape;
+
+        explicit shape_impl(Shape s) noexcept : shape{s} {}
+
+        [[nodiscard]] float area() const noexcept override
+        {
+            return shape_area(shape);
+        }
+    };
+
+    // Mostly small shapes, with a few large ones that set the size of every variant
+    template<typename Visitor>
+    void generate_shapes(std::size_t count, Visitor &&visitor)
+    {
+        auto const kinds = random_ints(0, 9);
+        auto const sizes = random_ints(1, 100);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            auto const size = static_cast<float>(sizes[wrap(i)]);
+            switch (kinds[wrap(i + i / input_count)])
+            {
+                case 0: visitor(large_polygon{{size, size, size, size, size, size, size, size}}); break;
+                case 1: case 2: case 3: case 4: visitor(small_circle{size}); break;
+                default: visitor(small_square{size}); break;
+            }
+        }
+    }
+
+    void poly_vector_variant_match(benchmark::State &state)
+    {
+        using shape = std::variant<small_circle, small_square, large_polygon>;
+        std::vector<shape> shapes;
+        generate_shapes(static_cast<std::size_t>(state.range(0)), [&](auto s) { shapes.emplace_back(s); });
+        for (auto _ : state)
+        {
+            float total = 0;
+            for (auto const &s : shapes)
+                total += match(s, shape_area);
+            benchmark::DoNotOptimize(total);
+        }
+        state.counters["bytes"] = static_cast<double>(shapes.size() * sizeof(shape));
+    }
+
+    void poly_vector_virtual(benchmark::State &state)
+    {
+        std::vector<std::unique_ptr<shape_base>> shapes;
+        std::size_t bytes = 0;
+        generate_shapes(static_cast<std::size_t>(state.range(0)), [&]<typename S>(S s) {
+            shapes.push_back(std::make_unique<shape_impl<S>>(s));
+            bytes += sizeof(std::unique_ptr<shape_base>) + sizeof(shape_impl<S>);
+        });
+        for (auto _ : state)
+        {
+            float total = 0;
+            for (auto const &s : shapes)
+                total += s->area();
+            benchmark::DoNotOptimize(total);
+        }
+        state.counters["bytes"] = static_cast<double>(bytes);
+    }
+
+    void poly_vector_for_each(benchmark::State &state)
+    {
+        poly_vector<small_circle, small_square, large_polygon> shapes;
+        generate_shapes(static_cast<std::size_t>(state.range(0)), [&](auto s) { shapes.push_back(s); });
+        for (auto _ : state)
+        {
+            float total = 0;
+            shapes.for_each([&](auto const &s) noexcept { total += shape_area(s); });
+            benchmark::DoNotOptimize(total);
+        }
+        state.counters["bytes"] = static_cast<double>(
+            shapes.size<small_circle>() * sizeof(small_circle) +
+            shapes.size<small_square>() * sizeof(small_square) +
+            shapes.size<large_polygon>() * sizeof(large_polygon)
+        );
+    }
+
+    BENCHMARK(poly_vector_variant_match)->Arg(1 << 16);
+    BENCHMARK(poly_vector_virtual)->Arg(1 << 16);
+    BENCHMARK(poly_vector_for_each)->Arg(1 << 16);
+}
@@ -0,0 +1,92 @@
+#include <unordered_set>
+#include <fun.hpp>
+#include "bench.hpp"
+
+namespace fun::bench
+{
+    // Key without padding, so it has unique object representations
+    struct instrument_key
+    {
+        int exchange;
+        int symbol;
+        long expiry;
+    };
+
+    struct instrument_key_hash
+    {
+        std::size_t operator()(instrument_key const &k) const noexcept
+        {
+            std::size_t seed = 0;
+            seed = detail::hash_combine(seed, std::hash<int>{}(k.exchange));
+            seed = detail::hash_combine(seed, std::hash<int>{}(k.symbol));
+            seed = detail::hash_combine(seed, std::hash<long>{}(k.expiry));
+            return seed;
+        }
+    };
+
+    struct instrument_key_equal
+    {
+        bool operator()(instrument_key const &lhs, instrument_key const &rhs) const noexcept
+        {
+            return lhs.exchange == rhs.exchange && lhs.symbol == rhs.symbol && lhs.expiry == rhs.expiry;
+        }
+    };
+
+    std::vector<instrument_key> random_keys()
+    {
+        auto const xs = random_ints(0, 255);
+        auto const ys = random_ints(0, 4095);
+        std::vector<instrument_key> keys;
+        keys.reserve(input_count);
+        for (std::size_t i = 0; i < input_count; ++i)
+            keys.push_back({xs[i], ys[i], xs[i] * 1000L + ys[i]});
+        return keys;
+    }
+
+    template<typename Hash, typename Equal>
+    void lookup(benchmark::State &state)
+    {
+        auto const keys = random_keys();
+        std::unordered_set<instrument_key, Hash, Equal> set(keys.begin(), keys.begin() + input_count / 2);
+        std::size_t i = 0;
+        for (auto _ : state)
+            benchmark::DoNotOptimize(set.contains(keys[wrap(i++)]));
+    }
+
+    void reflect_hash_hand_written(benchmark::State &state)
+    {
+        lookup<instrument_key_hash, instrument_key_equal>(state);
+    }
+
+    void reflect_hash_fields(benchmark::State &state)
+    {
+        lookup<fields_hash, fields_equal_to>(state);
+    }
+
+    void reflect_equal_hand_written(benchmark::State &state)
+    {
+        auto const keys = random_keys();
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(instrument_key_equal{}(keys[wrap(i)], keys[wrap(i + 1)]));
+            ++i;
+        }
+    }
+
+    void reflect_equal_fields(benchmark::State &state)
+    {
+        auto const keys = random_keys();
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(fields_equal_to{}(keys[wrap(i)], keys[wrap(i + 1)]));
+            ++i;
+        }
+    }
+
+    BENCHMARK(reflect_hash_hand_written);
+    BENCHMARK(reflect_hash_fields);
+    BENCHMARK(reflect_equal_hand_written);
+    BENCHMARK(reflect_equal_fields);
+}
@@ -0,0 +1,97 @@
+#include <array>
+#include <cstring>
+#include <fun.hpp>
+#include "bench.hpp"
+
+namespace fun::bench
+{
+    // Order record without padding, so all members can be copied at once
+    struct order
+    {
+        long id;
+        double price;
+        int quantity;
+        int side;
+        long timestamp;
+    };
+
+    using order_serializer = serializer<&order::id, &order::price, &order::quantity, &order::side, &order::timestamp>;
+
+    std::vector<order> random_order_records()
+    {
+        auto const xs = random_ints(0, 1000);
+        std::vector<order> orders;
+        orders.reserve(input_count);
+        for (int const x : xs)
+            orders.push_back({x, x * 0.25, x % 100, x % 2, x * 1000L});
+        return orders;
+    }
+
+    std::size_t serialize_by_hand(order const &o, std::byte *out) noexcept
+    {
+        std::byte *dst = out;
+        std::memcpy(dst, &o.id, sizeof(o.id)); dst += sizeof(o.id);
+        std::memcpy(dst, &o.price, sizeof(o.price)); dst += sizeof(o.price);
+        std::memcpy(dst, &o.quantity, sizeof(o.quantity)); dst += sizeof(o.quantity);
+        std::memcpy(dst, &o.side, sizeof(o.side)); dst += sizeof(o.side);
+        std::memcpy(dst, &o.timestamp, sizeof(o.timestamp)); dst += sizeof(o.timestamp);
+        return static_cast<std::size_t>(dst - out);
+    }
+
+    void serialize_hand_written(benchmark::State &state)
+    {
+        auto const orders = random_order_records();
+        std::array<std::byte, sizeof(order)> buffer{};
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(serialize_by_hand(orders[wrap(i++)], buffer.data()));
+            benchmark::ClobberMemory();
+        }
+    }
+
+    void serialize_whole_object(benchmark::State &state)
+    {
+        auto const orders = random_order_records();
+        std::array<std::byte, sizeof(order)> buffer{};
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            std::memcpy(buffer.data(), &orders[wrap(i++)], sizeof(order));
+            benchmark::ClobberMemory();
+        }
+    }
+
+    void serialize_serializer(benchmark::State &state)
+    {
+        auto const orders = random_order_records();
+        std::array<std::byte, sizeof(order)> buffer{};
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(order_serializer::serialize(orders[wrap(i++)], buffer));
+            benchmark::ClobberMemory();
+        }
+    }
+
+    void serialize_deserializer(benchmark::State &state)
+    {
+        auto const orders = random_order_records();
+        std::vector<std::array<std::byte, sizeof(order)>> buffers(input_count);
+        for (std::size_t j = 0; j < input_count; ++j)
+            order_serializer::serialize(orders[j], buffers[j]);
+
+        order o{};
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(order_serializer::deserialize(buffers[wrap(i++)], o));
+            benchmark::DoNotOptimize(o);
+        }
+    }
+
+    BENCHMARK(serialize_hand_written);
+    BENCHMARK(serialize_whole_object);
+    BENCHMARK(serialize_serializer);
+    BENCHMARK(serialize_deserializer);
+}
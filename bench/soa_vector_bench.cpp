@@ -0,0 +1,74 @@
+#include <fun.hpp>
+#include "bench.hpp"
+
+namespace fun::bench
+{
+    // Wide record of which the benchmarked loops only read two members
+    struct quote
+    {
+        long id;
+        double bid;
+        double ask;
+        double last;
+        double open;
+        double high;
+        double low;
+        double close;
+        int bid_size;
+        int ask_size;
+        long volume;
+        long timestamp;
+    };
+
+    using quote_columns = soa_vector<
+        &quote::id, &quote::bid, &quote::ask, &quote::last, &quote::open, &quote::high,
+        &quote::low, &quote::close, &quote::bid_size, &quote::ask_size, &quote::volume, &quote::timestamp
+    >;
+
+    inline constexpr std::size_t quote_count = 1 << 16;
+
+    quote random_quote(int x)
+    {
+        double const price = 100.0 + x;
+        return {x, price, price + 1, price, price, price, price, price, x, x, x * 10L, x * 1000L};
+    }
+
+    void soa_vector_array_of_structs(benchmark::State &state)
+    {
+        auto const xs = random_ints(0, 100);
+        std::vector<quote> quotes;
+        for (std::size_t i = 0; i < quote_count; ++i)
+            quotes.push_back(random_quote(xs[wrap(i)]));
+
+        for (auto _ : state)
+        {
+            double notional = 0.0;
+            for (auto const &q : quotes)
+                notional += q.last * static_cast<double>(q.volume);
+            benchmark::DoNotOptimize(notional);
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * quote_count));
+    }
+
+    void soa_vector_columns(benchmark::State &state)
+    {
+        auto const xs = random_ints(0, 100);
+        quote_columns quotes;
+        for (std::size_t i = 0; i < quote_count; ++i)
+            quotes.push_back(random_quote(xs[wrap(i)]));
+
+        for (auto _ : state)
+        {
+            auto const last = quotes.column<&quote::last>();
+            auto const volume = quotes.column<&quote::volume>();
+            double notional = 0.0;
+            for (std::size_t i = 0; i < last.size(); ++i)
+                notional += last[i] * static_cast<double>(volume[i]);
+            benchmark::DoNotOptimize(notional);
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * quote_count));
+    }
+
+    BENCHMARK(soa_vector_array_of_structs);
+    BENCHMARK(soa_vector_columns);
+}
@@ -0,0 +1,94 @@
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <fun.hpp>
+#include "bench.hpp"
+
+namespace fun::bench
+{
+    inline constexpr std::string_view verbs[] = {
+        "buy", "sell", "cancel", "modify", "status", "quote", "halt", "resume", "unknown"
+    };
+
+    std::vector<std::string_view> random_verbs()
+    {
+        auto const indices = random_ints(0, std::size(verbs) - 1);
+        std::vector<std::string_view> result;
+        result.reserve(input_count);
+        for (int const i : indices)
+            result.push_back(verbs[i]);
+        return result;
+    }
+
+    int verb_if_chain(std::string_view verb) noexcept
+    {
+        if (verb == "buy") return 1;
+        if (verb == "sell") return 2;
+        if (verb == "cancel") return 3;
+        if (verb == "modify") return 4;
+        if (verb == "status") return 5;
+        if (verb == "quote") return 6;
+        if (verb == "halt") return 7;
+        if (verb == "resume") return 8;
+        return 0;
+    }
+
+    int verb_string_match(std::string_view verb) noexcept
+    {
+        return string_match(
+            verb,
+            [](string_tag<"buy">) noexcept { return 1; },
+            [](string_tag<"sell">) noexcept { return 2; },
+            [](string_tag<"cancel">) noexcept { return 3; },
+            [](string_tag<"modify">) noexcept { return 4; },
+            [](string_tag<"status">) noexcept { return 5; },
+            [](string_tag<"quote">) noexcept { return 6; },
+            [](string_tag<"halt">) noexcept { return 7; },
+            [](string_tag<"resume">) noexcept { return 8; },
+            [](std::string_view) noexcept { return 0; }
+        );
+    }
+
+    void string_match_if_chain(benchmark::State &state)
+    {
+        auto const inputs = random_verbs();
+        std::size_t i = 0;
+        for (auto _ : state)
+            benchmark::DoNotOptimize(verb_if_chain(inputs[wrap(i++)]));
+    }
+
+    void string_match_unordered_map(benchmark::State &state)
+    {
+        auto const inputs = random_verbs();
+        std::unordered_map<std::string, std::function<int()>> const handlers{
+            {"buy", [] { return 1; }},
+            {"sell", [] { return 2; }},
+            {"cancel", [] { return 3; }},
+            {"modify", [] { return 4; }},
+            {"status", [] { return 5; }},
+            {"quote", [] { return 6; }},
+            {"halt", [] { return 7; }},
+            {"resume", [] { return 8; }}
+        };
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            // Heterogeneous lookup is not available for unordered containers in C++20
+            auto const it = handlers.find(std::string{inputs[wrap(i++)]});
+            benchmark::DoNotOptimize(it == handlers.end() ? 0 : it->second());
+        }
+    }
+
+    void string_match_perfect_hash(benchmark::State &state)
+    {
+        auto const inputs = random_verbs();
+        std::size_t i = 0;
+        for (auto _ : state)
+            benchmark::DoNotOptimize(verb_string_match(inputs[wrap(i++)]));
+    }
+
+    BENCHMARK(string_match_if_chain);
+    BENCHMARK(string_match_unordered_map);
+    BENCHMARK(string_match_perfect_hash);
+}
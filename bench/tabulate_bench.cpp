@@ -0,0 +1,34 @@
+#include <fun.hpp>
+#include "bench.hpp"
+
+namespace fun::bench
+{
+    // Bit count of a byte, computed without intrinsics so the loop cannot be replaced by a single instruction
+    constexpr int popcount(std::intmax_t x) noexcept
+    {
+        int count = 0;
+        for (; x != 0; x >>= 1)
+            count += static_cast<int>(x & 1);
+        return count;
+    }
+
+    void tabulate_direct(benchmark::State &state)
+    {
+        auto const xs = random_ints(0, 255);
+        std::size_t i = 0;
+        for (auto _ : state)
+            benchmark::DoNotOptimize(popcount(xs[wrap(i++)]));
+    }
+
+    void tabulate_table(benchmark::State &state)
+    {
+        auto const xs = random_ints(0, 255);
+        auto const table = tabulate<0, 255>(popcount);
+        std::size_t i = 0;
+        for (auto _ : state)
+            benchmark::DoNotOptimize(table(xs[wrap(i++)]));
+    }
+
+    BENCHMARK(tabulate_direct);
+    BENCHMARK(tabulate_table);
+}
@@ -0,0 +1,89 @@
+#include <variant>
+#include <vector>
+#include <fun.hpp>
+#include "bench.hpp"
+
+namespace fun::bench
+{
+    struct alignas(8) int_node { int value; };
+    struct alignas(8) real_node { double value; };
+
+    inline constexpr auto scalar_value = overload(
+        [](double d) noexcept { return d; },
+        [](int i) noexcept { return static_cast<double>(i); },
+        [](bool b) noexcept { return b ? 1.0 : 0.0; }
+    );
+
+    inline constexpr auto node_value = overload(
+        [](int_node const *n) noexcept { return static_cast<double>(n->value); },
+        [](real_node const *n) noexcept { return n->value; }
+    );
+
+    template<typename Variant>
+    std::vector<Variant> random_scalars(std::size_t count)
+    {
+        auto const kinds = random_ints(0, 2);
+        auto const values = random_ints(-1000, 1000);
+        std::vector<Variant> scalars;
+        scalars.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            int const value = values[wrap(i)];
+            switch (kinds[wrap(i + i / input_count)])
+            {
+                case 0: scalars.emplace_back(value * 0.25); break;
+                case 1: scalars.emplace_back(value); break;
+                default: scalars.emplace_back(value > 0); break;
+            }
+        }
+        return scalars;
+    }
+
+    template<typename Variant>
+    void variant_scalars(benchmark::State &state)
+    {
+        auto const scalars = random_scalars<Variant>(static_cast<std::size_t>(state.range(0)));
+        for (auto _ : state)
+        {
+            double sum = 0;
+            for (auto const &s : scalars)
+                sum += match(s, scalar_value);
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * scalars.size() * sizeof(Variant)));
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * scalars.size()));
+    }
+
+    template<typename Variant>
+    void variant_pointers(benchmark::State &state)
+    {
+        std::vector<int_node> ints(input_count);
+        std::vector<real_node> reals(input_count);
+        auto const kinds = random_ints(0, 1);
+        std::vector<Variant> nodes;
+        for (std::size_t i = 0; i < static_cast<std::size_t>(state.range(0)); ++i)
+        {
+            ints[wrap(i)].value = static_cast<int>(i);
+            reals[wrap(i)].value = static_cast<double>(i);
+            if (kinds[wrap(i + i / input_count)] == 0)
+                nodes.emplace_back(static_cast<int_node const *>(&ints[wrap(i)]));
+            else
+                nodes.emplace_back(static_cast<real_node const *>(&reals[wrap(i)]));
+        }
+
+        for (auto _ : state)
+        {
+            double sum = 0;
+            for (auto const &n : nodes)
+                sum += match(n, node_value);
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * nodes.size() * sizeof(Variant)));
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * nodes.size()));
+    }
+
+    BENCHMARK_TEMPLATE(variant_scalars, std::variant<double, int, bool>)->Arg(1 << 20);
+    BENCHMARK_TEMPLATE(variant_scalars, fun::variant<double, int, bool>)->Arg(1 << 20);
+    BENCHMARK_TEMPLATE(variant_pointers, std::variant<int_node const *, real_node const *>)->Arg(1 << 20);
+    BENCHMARK_TEMPLATE(variant_pointers, fun::variant<int_node const *, real_node const *>)->Arg(1 << 20);
+}
@@ -0,0 +1,45 @@
+#include <fun.hpp>
+#include "bench.hpp"
+
+namespace fun::bench
+{
+    void with_arity_direct(benchmark::State &state)
+    {
+        auto const xs = random_ints(-100, 100);
+        auto const f = [](int x, int y) noexcept { return x - y; };
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(f(xs[wrap(i)], xs[wrap(i + 1)]));
+            ++i;
+        }
+    }
+
+    void with_arity_adapted(benchmark::State &state)
+    {
+        auto const xs = random_ints(-100, 100);
+        auto const f = with_arity<2>([](auto x, auto y) noexcept { return x - y; });
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(f(xs[wrap(i)], xs[wrap(i + 1)]));
+            ++i;
+        }
+    }
+
+    void with_arity_nullsink(benchmark::State &state)
+    {
+        auto const xs = random_ints(-100, 100);
+        auto const f = nullsink<2>([]() noexcept { return 0; });
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(f(xs[wrap(i)], xs[wrap(i + 1)]));
+            ++i;
+        }
+    }
+
+    BENCHMARK(with_arity_direct);
+    BENCHMARK(with_arity_adapted);
+    BENCHMARK(with_arity_nullsink);
+}
@@ -13,21 +13,28 @@ class earth
     std::size_t _radius = 6371000;
 };
 
+// Callables that will receive the (possibly private) member pointers
+inline constexpr auto print_gravity = [](double earth::*ptr) {
+    earth e{};
+    std::cout << "Gravity is " << e.*ptr << '\n';
+    e.*ptr = 99.999;
+    std::cout << "Gravity modified to " << e.*ptr << '\n';
+};
+
+inline constexpr auto print_password = [](std::string_view vault::*ptr) {
+    vault v{};
+    std::cout << "The password is " << v.*ptr << '\n';
+};
+
+inline constexpr auto print_unknown = [](auto other) {
+    std::cout << "Unknown type: " << typeid(other).name() << '\n';
+};
+
 // Accessing private member pointers can be done by injecting them into supplied functions
 template struct fun::member_pointers<&vault::_password, &earth::_gravity, &earth::_radius>::match<
-    [](double earth::*ptr) {
-        earth e{};
-        std::cout << "Gravity is " << e.*ptr << '\n';
-        e.*ptr = 99.999;
-        std::cout << "Gravity modified to " << e.*ptr << '\n';
-    },
-    [](std::string_view vault::*ptr) {
-        vault v{};
-        std::cout << "The password is " << v.*ptr << '\n';
-    },
-    [](auto other) {
-        std::cout << "Unknown type: " << typeid(other).name() << '\n';
-    }
+    print_gravity,
+    print_password,
+    print_unknown
 >;
 
 struct password_accessor
@@ -38,11 +45,28 @@ struct password_accessor
 // We can also enable public access to _password through password_accessor
 template struct fun::enable_access<&vault::_password, password_accessor>;
 
+// Any tag type works as well, the pointer is then only available as a compile-time constant
+struct radius_tag {};
+template struct fun::enable_access<&earth::_radius, radius_tag>;
+
+// Layouts of classes with private members can be audited at compile time and reported at runtime
+template struct fun::audit_layout<fun::member_pointers<&earth::_gravity, &earth::_radius>, 0>;
+
+inline constexpr auto print_layout = [](auto... ptrs) {
+    std::cout << fun::measure_layout(ptrs ...);
+};
+
+template struct fun::member_pointers<&earth::_gravity, &earth::_radius>::access<print_layout>;
+
 int main()
 {
     vault v{};
     v.*password_accessor::ptr = "updated";
     std::cout << "The password is " << v.*password_accessor::ptr << '\n';
+    std::cout << "The password is still " << v.*fun::accessed_ptr<password_accessor> << '\n';
+
+    constexpr std::size_t radius = earth{}.*fun::accessed_ptr<radius_tag>;
+    std::cout << "Radius is " << radius << '\n';
 }
 
 
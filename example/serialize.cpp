@@ -0,0 +1,42 @@
+#include <array>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <fun.hpp>
+
+class account
+{
+    int _id = 0;
+    int _flags = 0;
+    double _balance = 0.0;
+    std::string _owner;
+
+public:
+    account() = default;
+
+    account(int id, double balance, std::string owner) : _id{id}, _balance{balance}, _owner{std::move(owner)} {}
+
+    friend std::ostream &operator<<(std::ostream &out, account const &a)
+    {
+        return out << a._owner << " #" << a._id << ": " << a._balance;
+    }
+};
+
+// The private members become serializable, the first three are copied at once
+template struct fun::serializable<
+    fun::member_pointers<&account::_id, &account::_flags, &account::_balance, &account::_owner>
+>;
+
+int main()
+{
+    using account_serializer = fun::serializer_of<account>;
+
+    std::array<std::byte, 64> buffer{};
+    account const original{42, 1234.5, "alice"};
+    std::size_t const written = account_serializer::serialize(original, buffer);
+
+    account copy{};
+    std::size_t const read = account_serializer::deserialize(std::span{buffer}.first(written), copy);
+    std::cout << "Wrote " << written << " bytes, read " << read << " bytes\n";
+    std::cout << copy << '\n';
+}
@@ -2,9 +2,24 @@
 #define FUN_HPP
 
 #include <fun/curry.hpp>
+#include <fun/dispatch.hpp>
+#include <fun/dispatcher.hpp>
+#include <fun/function_ref.hpp>
+#include <fun/inplace_function.hpp>
+#include <fun/layout.hpp>
 #include <fun/literals.hpp>
+#include <fun/match_all.hpp>
 #include <fun/member_pointer.hpp>
+#include <fun/memoize.hpp>
 #include <fun/overload.hpp>
+#include <fun/pipeline.hpp>
+#include <fun/poly_vector.hpp>
+#include <fun/reflect.hpp>
+#include <fun/serialize.hpp>
+#include <fun/soa_vector.hpp>
+#include <fun/string_match.hpp>
+#include <fun/tabulate.hpp>
+#include <fun/variant.hpp>
 #include <fun/with_arity.hpp>
 
 #endif // FUN_HPP
\ No newline at end of file
@@ -3,6 +3,7 @@
 
 #include <concepts>
 #include <functional>
+#include <tuple>
 #include <utility>
 #include <fun/traits.hpp>
 
@@ -20,16 +21,141 @@ namespace fun
         template<traits::callable F, typename... Args>
         inline constexpr bool is_nothrow_if_invocable_v = is_nothrow_if_invocable<F, Args ...>::value;
 
-        template<traits::callable F, typename... Args>
+        template<std::size_t Stored, traits::callable F, typename... Args>
+        constexpr decltype(auto) curry_impl(F &&f, Args &&... args) noexcept(is_nothrow_if_invocable_v<F &&, Args &&...>);
+    }
+
+    template<traits::callable F, typename Args>
+    class curried;
+
+    /**
+     * Partial application of a curried function, which stores the callable and the arguments received so far
+     * in a flat layout. Empty callables and argument lists take no space.
+     * Any number of arguments can be passed at each step.
+     * Invoking an lvalue curried object copies the stored state into the next step, while invoking
+     * an rvalue curried object moves it, which allows currying functions that take move-only arguments.
+     *
+     * @tparam F    The type of the callable being curried
+     * @tparam Args The types of the arguments received so far
+     */
+    template<traits::callable F, typename... Args>
+    class curried<F, std::tuple<Args ...>>
+    {
+        FUN_NO_UNIQUE_ADDRESS F _f;
+        FUN_NO_UNIQUE_ADDRESS std::tuple<Args ...> _args;
+
+        template<typename Self, std::size_t... Indices, typename... Ts>
+        static constexpr decltype(auto) step(Self &&self, std::index_sequence<Indices ...>, Ts &&... ts)
+        {
+            return detail::curry_impl<sizeof... (Args)>(
+                std::forward<Self>(self)._f,
+                std::get<Indices>(std::forward<Self>(self)._args) ...,
+                std::forward<Ts>(ts) ...
+            );
+        }
+
+    public:
+        template<typename G, typename... Ts>
+        constexpr explicit curried(std::in_place_t, G &&g, Ts &&... ts)
+            : _f(std::forward<G>(g)), _args(std::forward<Ts>(ts) ...) {}
+
+        template<typename... Ts>
+        requires (sizeof... (Ts) > 0)
+        constexpr decltype(auto) operator()(Ts &&... ts) const &
+            noexcept(detail::is_nothrow_if_invocable_v<F const &, Args const &..., Ts &&...>)
+        {
+            return step(*this, std::index_sequence_for<Args ...>{}, std::forward<Ts>(ts) ...);
+        }
+
+        template<typename... Ts>
+        requires (sizeof... (Ts) > 0)
+        constexpr decltype(auto) operator()(Ts &&... ts) &&
+            noexcept(detail::is_nothrow_if_invocable_v<F &&, Args &&..., Ts &&...>)
+        {
+            return step(std::move(*this), std::index_sequence_for<Args ...>{}, std::forward<Ts>(ts) ...);
+        }
+    };
+
+    namespace detail
+    {
+        template<typename>
+        inline constexpr bool is_curried_v = false;
+
+        template<typename F, typename Args>
+        inline constexpr bool is_curried_v<curried<F, Args>> = true;
+
+        template<typename F, typename Args, typename Indices>
+        inline constexpr bool is_prefix_invocable_v = false;
+
+        template<typename F, typename... Args, std::size_t... Indices>
+        inline constexpr bool is_prefix_invocable_v<F, std::tuple<Args ...>, std::index_sequence<Indices ...>> =
+            std::is_invocable_v<F, std::tuple_element_t<Indices, std::tuple<Args ...>> ...>;
+
+        /**
+         * Determines how many of the received arguments are consumed when invoking the function,
+         * or 0 if it cannot be invoked yet. Prefixes of at most Stored arguments were already
+         * checked by previous steps. When the arity is known, only one prefix needs to be checked.
+         */
+        template<std::size_t Stored, typename F, typename... Args>
+        constexpr std::size_t invocable_prefix() noexcept
+        {
+            using arguments = std::tuple<Args &&...>;
+            constexpr std::size_t arity = traits::call_arity_v<F>;
+
+            if constexpr (arity != traits::unknown_arity)
+            {
+                if constexpr (Stored < arity && arity <= sizeof... (Args))
+                    return is_prefix_invocable_v<F &&, arguments, std::make_index_sequence<arity>> ? arity : 0;
+                else
+                    return 0;
+            }
+            else
+            {
+                return []<std::size_t... Indices>(std::index_sequence<Indices ...>) {
+                    std::size_t prefix = 0;
+                    static_cast<void>((
+                        (is_prefix_invocable_v<F &&, arguments, std::make_index_sequence<Stored + 1 + Indices>>
+                            ? (prefix = Stored + 1 + Indices, true)
+                            : false) || ...
+                    ));
+                    return prefix;
+                }(std::make_index_sequence<sizeof... (Args) - Stored>{});
+            }
+        }
+
+        template<traits::callable F, typename Args, std::size_t... Prefix, std::size_t... Rest>
+        constexpr decltype(auto) curry_split(F &&f, Args &&args, std::index_sequence<Prefix ...>, std::index_sequence<Rest ...>)
+        {
+            using result = decltype(std::invoke(std::forward<F>(f), std::get<Prefix>(std::move(args)) ...));
+            static_assert(traits::is_callable_v<result>, "too many arguments");
+
+            // The remaining arguments are applied to the result with the same currying rules
+            return curry_impl<0>(
+                std::invoke(std::forward<F>(f), std::get<Prefix>(std::move(args)) ...),
+                std::get<sizeof... (Prefix) + Rest>(std::move(args)) ...
+            );
+        }
+
+        template<std::size_t Stored, traits::callable F, typename... Args>
         constexpr decltype(auto) curry_impl(F &&f, Args &&... args) noexcept(is_nothrow_if_invocable_v<F &&, Args &&...>)
         {
-            if constexpr (requires { std::invoke(std::forward<F>(f), std::forward<Args>(args) ...); })
+            constexpr std::size_t prefix = invocable_prefix<Stored, F, Args ...>();
+
+            if constexpr (prefix == 0)
+                return curried<std::decay_t<F>, std::tuple<std::decay_t<Args> ...>>{
+                    std::in_place,
+                    std::forward<F>(f),
+                    std::forward<Args>(args) ...
+                };
+            else if constexpr (prefix == sizeof... (Args))
                 return std::invoke(std::forward<F>(f), std::forward<Args>(args) ...);
             else
-                return [f = std::forward<F>(f), ...args = std::forward<Args>(args)]<typename Arg>(Arg &&arg)
-                    noexcept(is_nothrow_if_invocable_v<F &&, Args &&..., Arg &&>) -> decltype(auto) {
-                        return curry_impl(f, args ..., std::forward<Arg>(arg));
-                    };
+                return curry_split(
+                    std::forward<F>(f),
+                    std::forward_as_tuple(std::forward<Args>(args) ...),
+                    std::make_index_sequence<prefix>{},
+                    std::make_index_sequence<sizeof... (Args) - prefix>{}
+                );
         }
 
         template<traits::callable F, typename Arg, typename... Args>
@@ -52,13 +178,19 @@ namespace fun
 
     /**
      * Adapts a given callable object to allow curried invocation. A curried function can be
-     * invoked by passing arguments one at a time.
+     * invoked by passing arguments one at a time, or any number of them at once.
+     * The function is invoked as soon as enough arguments have been received and any remaining
+     * arguments are passed to its result.
      * Calling the curried object with invalid argument types will not generate compilation errors
      * but will never actually call the original function.
+     * Invoking a temporary curried object moves the arguments received so far into the next step,
+     * so only the curried objects that are kept as lvalues need copyable arguments.
+     * When the callable has a single call signature, its arity is known in advance and invocation
+     * is only attempted once all arguments have been received.
      *
      * @tparam F    The type of the callable being adapted
      * @param f     The callable object being adapted
-     * @return      A lambda expression which behaves as a curried version of the original callable
+     * @return      A curried object which behaves as a curried version of the original callable
      */
     template<traits::callable F>
     [[nodiscard]] constexpr decltype(auto) curry(F &&f) noexcept
@@ -66,13 +198,14 @@ namespace fun
         if constexpr (requires { std::invoke(std::forward<F>(f)); })
             return std::forward<F>(f);
         else
-            return detail::curry_impl(std::forward<F>(f));
+            return detail::curry_impl<0>(std::forward<F>(f));
     }
 
     /**
      * Receives a curried calalble object and returns a lambda expression which allows passing
      * multiple parameters at once to the initial curried function.
-     * Must only be called on curried functors.
+     * Must only be called on curried functors. Objects returned by curry already accept multiple
+     * arguments, so they are invoked with a single application instead of one call per argument.
      *
      * @tparam F    The type of the curried callable
      * @param f     The curried callable
@@ -83,14 +216,17 @@ namespace fun
     {
         if constexpr (requires { std::invoke(std::forward<F>(f)); })
             return std::forward<F>(f);
+        else if constexpr (detail::is_curried_v<std::remove_cvref_t<F>>)
+            return [f = std::forward<F>(f)]<typename... Args>(Args &&... args)
+                noexcept(std::is_nothrow_invocable_v<std::remove_cvref_t<F> const &, Args &&...>) -> decltype(auto) {
+                    static_assert(!traits::is_callable_v<decltype(f(std::forward<Args>(args) ...))>, "not enough parameters");
+                    return f(std::forward<Args>(args) ...);
+                };
         else
             return [f = std::forward<F>(f)]<typename Arg, typename... Args>(Arg &&arg, Args &&... args)
                 noexcept(std::is_nothrow_invocable_v<F &&, Arg &&>) -> decltype(auto) {
-                    return detail::uncurry_impl(
-                        std::invoke(f, std::forward<Arg>(arg)),
-                        std::forward<Args>(args) ...
-                    );
+                    return detail::uncurry_impl(f, std::forward<Arg>(arg), std::forward<Args>(args) ...);
                 };
     }
 }
-#endif //FUN_CURRY_HPP
\ No newline at end of file
+#endif //FUN_CURRY_HPP
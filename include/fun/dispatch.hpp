@@ -0,0 +1,305 @@
+#ifndef FUN_DISPATCH_HPP
+#define FUN_DISPATCH_HPP
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <fun/traits.hpp>
+#include <fun/utility.hpp>
+
+namespace fun
+{
+    namespace detail
+    {
+        // Indices with at most this many possible values are dispatched through a switch statement
+        inline constexpr std::size_t max_switch_cases = 32;
+
+        template<typename R, std::size_t Size, typename Visitor>
+        struct index_dispatcher
+        {
+            template<std::size_t Index>
+            static constexpr R arm(Visitor &&visitor)
+            {
+                if constexpr (Index >= Size)
+                    unreachable();
+                else
+                    return std::forward<Visitor>(visitor).template operator()<Index>();
+            }
+
+            template<std::size_t... Indices>
+            static constexpr auto make_arms(std::index_sequence<Indices ...>) noexcept
+            {
+                return std::array<R (*)(Visitor &&), sizeof... (Indices)>{&arm<Indices> ...};
+            }
+
+            static constexpr auto arms = make_arms(std::make_index_sequence<Size>{});
+
+            static constexpr R dispatch(std::size_t index, Visitor &&visitor)
+            {
+                if constexpr (Size > max_switch_cases)
+                {
+                    return arms[index](std::forward<Visitor>(visitor));
+                }
+                else
+                {
+                    // Cases past the end of the index range are never taken and get optimized away
+                    switch (index)
+                    {
+                        case 0: return arm<0>(std::forward<Visitor>(visitor));
+                        case 1: return arm<1>(std::forward<Visitor>(visitor));
+                        case 2: return arm<2>(std::forward<Visitor>(visitor));
+                        case 3: return arm<3>(std::forward<Visitor>(visitor));
+                        case 4: return arm<4>(std::forward<Visitor>(visitor));
+                        case 5: return arm<5>(std::forward<Visitor>(visitor));
+                        case 6: return arm<6>(std::forward<Visitor>(visitor));
+                        case 7: return arm<7>(std::forward<Visitor>(visitor));
+                        case 8: return arm<8>(std::forward<Visitor>(visitor));
+                        case 9: return arm<9>(std::forward<Visitor>(visitor));
+                        case 10: return arm<10>(std::forward<Visitor>(visitor));
+                        case 11: return arm<11>(std::forward<Visitor>(visitor));
+                        case 12: return arm<12>(std::forward<Visitor>(visitor));
+                        case 13: return arm<13>(std::forward<Visitor>(visitor));
+                        case 14: return arm<14>(std::forward<Visitor>(visitor));
+                        case 15: return arm<15>(std::forward<Visitor>(visitor));
+                        case 16: return arm<16>(std::forward<Visitor>(visitor));
+                        case 17: return arm<17>(std::forward<Visitor>(visitor));
+                        case 18: return arm<18>(std::forward<Visitor>(visitor));
+                        case 19: return arm<19>(std::forward<Visitor>(visitor));
+                        case 20: return arm<20>(std::forward<Visitor>(visitor));
+                        case 21: return arm<21>(std::forward<Visitor>(visitor));
+                        case 22: return arm<22>(std::forward<Visitor>(visitor));
+                        case 23: return arm<23>(std::forward<Visitor>(visitor));
+                        case 24: return arm<24>(std::forward<Visitor>(visitor));
+                        case 25: return arm<25>(std::forward<Visitor>(visitor));
+                        case 26: return arm<26>(std::forward<Visitor>(visitor));
+                        case 27: return arm<27>(std::forward<Visitor>(visitor));
+                        case 28: return arm<28>(std::forward<Visitor>(visitor));
+                        case 29: return arm<29>(std::forward<Visitor>(visitor));
+                        case 30: return arm<30>(std::forward<Visitor>(visitor));
+                        case 31: return arm<31>(std::forward<Visitor>(visitor));
+                        default: unreachable();
+                    }
+                }
+            }
+        };
+
+        /**
+         * Invokes visitor.template operator()<I>() with a runtime index I, which must be less than Size.
+         * Small ranges use a switch statement whose arms can be inlined, larger ones use a table of function pointers.
+         */
+        template<typename R, std::size_t Size, typename Visitor>
+        constexpr R visit_index(std::size_t index, Visitor &&visitor)
+        {
+            return index_dispatcher<R, Size, Visitor>::dispatch(index, std::forward<Visitor>(visitor));
+        }
+
+        // Dispatch spaces are limited to this many entries, since each one instantiates the dispatched function
+        inline constexpr std::size_t max_dispatch_size = std::size_t{1} << 16;
+
+        // Default fallback of dispatch, which throws std::out_of_range
+        struct out_of_range_fallback {};
+
+        /**
+         * Maps combinations of Count values in the range [Min, Max] to flat indices, row-major.
+         */
+        template<std::intmax_t Min, std::intmax_t Max, std::size_t Count>
+        struct tag_space
+        {
+            static_assert(Min <= Max, "the dispatch range must not be empty");
+
+            static constexpr std::size_t extent = static_cast<std::size_t>(Max - Min) + 1;
+
+            static constexpr std::size_t size = [] {
+                std::size_t result = 1;
+                for (std::size_t dim = 0; dim < Count && result <= max_dispatch_size; ++dim)
+                    result *= extent;
+                return result;
+            }();
+
+            static_assert(size <= max_dispatch_size, "the dispatch space is too large");
+
+            static constexpr std::size_t stride(std::size_t dim) noexcept
+            {
+                std::size_t result = 1;
+                while (++dim < Count)
+                    result *= extent;
+                return result;
+            }
+
+            template<std::size_t Flat, std::size_t Dim>
+            using tag_at = tag<Min + static_cast<std::intmax_t>(Flat / stride(Dim) % extent)>;
+
+            template<std::integral... Ints>
+            static constexpr bool contains(Ints... values) noexcept
+            {
+                // Character and boolean types are promoted, since the safe comparison functions reject them
+                return ((std::cmp_greater_equal(+values, Min) && std::cmp_less_equal(+values, Max)) && ...);
+            }
+
+            template<std::integral... Ints>
+            static constexpr std::size_t flatten(Ints... values) noexcept
+            {
+                std::size_t flat = 0;
+                ((flat = flat * extent + static_cast<std::size_t>(static_cast<std::intmax_t>(values) - Min)), ...);
+                return flat;
+            }
+        };
+
+        template<typename Space, typename F, typename Flats, typename Dims>
+        struct tag_invocation;
+
+        template<typename Space, typename F, std::size_t... Flats, std::size_t... Dims>
+        struct tag_invocation<Space, F, std::index_sequence<Flats ...>, std::index_sequence<Dims ...>>
+        {
+            template<std::size_t Flat>
+            static constexpr bool invocable = std::is_invocable_v<F, typename Space::template tag_at<Flat, Dims> ...>;
+
+            template<std::size_t Flat>
+            using result = std::invoke_result_t<F, typename Space::template tag_at<Flat, Dims> ...>;
+
+            // Array initialization does not nest like a fold expression, so large spaces stay within compiler limits
+            static constexpr std::size_t first_invocable = [] {
+                constexpr bool flags[] = {invocable<Flats> ..., true};
+                std::size_t flat = 0;
+                while (!flags[flat])
+                    ++flat;
+                return flat;
+            }();
+        };
+
+        template<typename Space, typename F, typename Fallback, typename... Ints>
+        struct dispatch_result_impl
+        {
+            using invocation = tag_invocation<
+                Space,
+                F,
+                std::make_index_sequence<Space::size>,
+                std::index_sequence_for<Ints ...>
+            >;
+
+            static constexpr auto deduce() noexcept
+            {
+                if constexpr (invocation::first_invocable < Space::size)
+                    return std::type_identity<typename invocation::template result<invocation::first_invocable>>{};
+                else if constexpr (std::is_same_v<Fallback, out_of_range_fallback>)
+                    return std::type_identity<void>{};
+                else
+                    return std::type_identity<std::invoke_result_t<Fallback, Ints ...>>{};
+            }
+
+            using type = typename decltype(deduce())::type;
+        };
+
+        template<typename R, typename Fallback, typename... Ints>
+        constexpr R invoke_fallback(Fallback &&fallback, Ints... values)
+        {
+            if constexpr (std::is_same_v<std::remove_cvref_t<Fallback>, out_of_range_fallback>)
+            {
+                throw std::out_of_range{"dispatched value out of range"};
+            }
+            else
+            {
+                static_assert(
+                    std::is_convertible_v<std::invoke_result_t<Fallback, Ints ...>, R>,
+                    "the fallback must return a type convertible to the result of the dispatched function"
+                );
+                return std::invoke(std::forward<Fallback>(fallback), values ...);
+            }
+        }
+
+        template<std::intmax_t Min, std::intmax_t Max, typename F, typename Fallback, std::integral... Ints>
+        constexpr decltype(auto) dispatch_values(F &&f, Fallback &&fallback, Ints... values)
+        {
+            using space = tag_space<Min, Max, sizeof... (Ints)>;
+            using impl = dispatch_result_impl<space, F, std::remove_cvref_t<Fallback>, Ints ...>;
+            using result = typename impl::type;
+
+            if (!space::contains(values ...))
+                return invoke_fallback<result>(std::forward<Fallback>(fallback), values ...);
+
+            return visit_index<result, space::size>(space::flatten(values ...), [&]<std::size_t Flat>() -> result {
+                if constexpr (impl::invocation::template invocable<Flat>)
+                {
+                    static_assert(
+                        std::is_same_v<typename impl::invocation::template result<Flat>, result>,
+                        "the dispatched function must return the same type for all values"
+                    );
+                    return [&]<std::size_t... Dims>(std::index_sequence<Dims ...>) -> result {
+                        return std::invoke(std::forward<F>(f), typename space::template tag_at<Flat, Dims>{} ...);
+                    }(std::index_sequence_for<Ints ...>{});
+                }
+                else
+                {
+                    return invoke_fallback<result>(std::forward<Fallback>(fallback), values ...);
+                }
+            });
+        }
+
+        template<typename... Args>
+        constexpr std::size_t leading_integrals() noexcept
+        {
+            constexpr bool flags[] = {std::integral<std::remove_cvref_t<Args>> ..., false};
+            std::size_t count = 0;
+            while (flags[count])
+                ++count;
+            return count;
+        }
+
+        template<std::intmax_t Min, std::intmax_t Max, typename Args, std::size_t... ValueIndices, std::size_t... CallableIndices>
+        constexpr decltype(auto) dispatch_split(
+            Args &&args,
+            std::index_sequence<ValueIndices ...>,
+            std::index_sequence<CallableIndices ...>
+        )
+        {
+            constexpr std::size_t value_count = sizeof... (ValueIndices);
+            return dispatch_values<Min, Max>(
+                std::get<value_count + CallableIndices>(std::move(args)) ...,
+                std::get<ValueIndices>(std::move(args)) ...
+            );
+        }
+    }
+
+    /**
+     * Converts runtime integers into compile-time tags. All leading integral arguments are the dispatched values,
+     * followed by the function that receives one tag<I> for each value, and an optional fallback.
+     * All combinations of values in the range [Min, Max] are dispatched through a single jump, so the function
+     * can be an overload set of tag signatures, or a curried function that receives one tag at a time.
+     * The fallback is invoked with the original values when any of them is out of range, or when the function
+     * cannot be invoked with their tags. Without a fallback, std::out_of_range is thrown instead.
+     * The function must return the same type for all combinations of values, and the result of the fallback
+     * must be convertible to it.
+     *
+     * @tparam Min  The smallest value that is dispatched
+     * @tparam Max  The largest value that is dispatched
+     * @tparam Args The types of the dispatched values, followed by the types of the function and fallback
+     * @param args  The dispatched values, followed by the function and optional fallback
+     * @return      The result of invoking the function with the tags of the dispatched values
+     */
+    template<std::intmax_t Min, std::intmax_t Max, typename... Args>
+    [[nodiscard]] constexpr decltype(auto) dispatch(Args &&... args)
+    {
+        constexpr std::size_t value_count = detail::leading_integrals<Args ...>();
+        static_assert(value_count > 0, "at least one value must be dispatched");
+
+        constexpr std::size_t callable_count = sizeof... (Args) - value_count;
+        static_assert(callable_count == 1 || callable_count == 2, "expected a function and an optional fallback");
+
+        if constexpr (callable_count == 1)
+            return detail::dispatch_split<Min, Max>(
+                std::forward_as_tuple(std::forward<Args>(args) ..., detail::out_of_range_fallback{}),
+                std::make_index_sequence<value_count>{},
+                std::make_index_sequence<2>{}
+            );
+        else
+            return detail::dispatch_split<Min, Max>(
+                std::forward_as_tuple(std::forward<Args>(args) ...),
+                std::make_index_sequence<value_count>{},
+                std::make_index_sequence<2>{}
+            );
+    }
+}
+#endif //FUN_DISPATCH_HPP
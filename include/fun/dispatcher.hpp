@@ -0,0 +1,295 @@
+#ifndef FUN_DISPATCHER_HPP
+#define FUN_DISPATCHER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <fun/traits.hpp>
+#include <fun/with_arity.hpp>
+
+namespace fun
+{
+    namespace detail
+    {
+        inline constexpr std::size_t unassigned_message_type = static_cast<std::size_t>(-1);
+
+        // Dense ids are only assigned to the types handled by some dispatcher, so their tables stay small
+        inline constinit std::atomic<std::size_t> next_message_type{0};
+
+        template<typename T>
+        inline constinit std::atomic<std::size_t> message_type_id{unassigned_message_type};
+
+        template<typename T>
+        std::size_t assign_message_type_id() noexcept
+        {
+            std::size_t id = message_type_id<T>.load(std::memory_order_acquire);
+            if (id == unassigned_message_type)
+            {
+                // A thread that loses the race discards its id and takes the one that was stored first
+                std::size_t const candidate = next_message_type.fetch_add(1, std::memory_order_relaxed);
+                if (message_type_id<T>.compare_exchange_strong(id, candidate, std::memory_order_acq_rel))
+                    id = candidate;
+            }
+            return id;
+        }
+    }
+
+    /**
+     * Type-erased reference to a message of any type, made of a type id and a pointer to the referred object.
+     * The message does not extend the lifetime of the object, which must outlive it.
+     */
+    class message
+    {
+        std::atomic<std::size_t> const *_type;
+        void const *_data;
+
+    public:
+        template<typename T>
+        requires (!std::is_same_v<std::remove_cvref_t<T>, message>)
+        constexpr explicit(false) message(T const &value) noexcept
+            : _type{&detail::message_type_id<T>}, _data{std::addressof(value)} {}
+
+        /**
+         * The dense id of the type of the referred object, or a value larger than any id if no dispatcher handles it.
+         */
+        [[nodiscard]] std::size_t type() const noexcept
+        {
+            return _type->load(std::memory_order_relaxed);
+        }
+
+        template<typename T>
+        [[nodiscard]] constexpr bool holds() const noexcept
+        {
+            return _type == &detail::message_type_id<std::remove_cvref_t<T>>;
+        }
+
+        [[nodiscard]] constexpr void const *data() const noexcept
+        {
+            return _data;
+        }
+
+        /**
+         * Pointer to the referred object if it has the given type, otherwise nullptr.
+         */
+        template<typename T>
+        [[nodiscard]] T const *get_if() const noexcept
+        {
+            return holds<T>() ? static_cast<T const *>(_data) : nullptr;
+        }
+    };
+
+    namespace detail
+    {
+        // Handlers that take anything other than a fun::message are typed, the remaining one is the fallback
+        template<typename F>
+        inline constexpr bool is_typed_handler = [] {
+            if constexpr (traits::signature_of<F>::arity == 1)
+                return !std::is_same_v<std::remove_cvref_t<typename traits::signature_of<F>::template parameter<0>>, message>;
+            else
+                return false;
+        }();
+
+        template<typename F>
+        struct handled_type : std::type_identity<void> {};
+
+        template<typename F>
+        requires is_typed_handler<F>
+        struct handled_type<F> : std::remove_cvref<typename traits::signature_of<F>::template parameter<0>> {};
+
+        template<typename F>
+        using handled_type_t = typename handled_type<F>::type;
+
+        template<typename F>
+        inline constexpr bool accepts_const_message = [] {
+            if constexpr (is_typed_handler<F>)
+                return std::is_invocable_v<F const &, handled_type_t<F> const &>;
+            else
+                return true;
+        }();
+
+        template<typename F, typename R>
+        inline constexpr bool handler_returns = [] {
+            if constexpr (is_typed_handler<F> && accepts_const_message<F>)
+                return std::is_same_v<std::invoke_result_t<F const &, handled_type_t<F> const &>, R>;
+            else
+                return true;
+        }();
+    }
+
+    /**
+     * Dispatches type-erased messages to the handler that takes their type, through a table indexed by the type id.
+     * The table is built once for each dispatcher type, so every dispatch is a single indexed indirect call.
+     * Each handler must have a single call signature with one parameter, which receives the message by value
+     * or by const reference, and all handlers must return the same type. The parameter types must be distinct.
+     * Messages of other types are passed to the one handler that takes a fun::message or is generic,
+     * such as a fun::nullsink<1>. Without such a fallback they are discarded, which requires handlers
+     * that return nothing.
+     *
+     * @tparam Fs   The types of the handlers
+     */
+    template<typename... Fs>
+    class dispatcher
+    {
+        using handlers_type = std::tuple<Fs ...>;
+
+        template<std::size_t I>
+        using handler = std::tuple_element_t<I, handlers_type>;
+
+        static constexpr std::size_t size = sizeof... (Fs);
+
+        // Position of the handler that is not typed, or size if there is none
+        static constexpr std::size_t fallback_index = [] {
+            constexpr bool flags[] = {!detail::is_typed_handler<Fs> ..., true};
+            std::size_t index = 0;
+            while (!flags[index])
+                ++index;
+            return index;
+        }();
+
+        static constexpr bool has_fallback = fallback_index < size;
+
+        static_assert(
+            ((detail::is_typed_handler<Fs> ? 0 : 1) + ... + 0) <= 1,
+            "handlers must have a single parameter of a deducible type, except for one fallback"
+        );
+
+        // Position of the first handler of a type, which must be the only one
+        template<typename T>
+        static constexpr std::size_t handler_index = [] {
+            constexpr bool flags[] = {std::is_same_v<T, detail::handled_type_t<Fs>> ..., true};
+            std::size_t index = 0;
+            while (!flags[index])
+                ++index;
+            return index;
+        }();
+
+        static_assert(
+            []<std::size_t... Is>(std::index_sequence<Is ...>) {
+                return ((!detail::is_typed_handler<Fs> || handler_index<detail::handled_type_t<Fs>> == Is) && ...);
+            }(std::index_sequence_for<Fs ...>{}),
+            "each message type must have a single handler"
+        );
+
+        static_assert(
+            (detail::accepts_const_message<Fs> && ...),
+            "handlers must receive their message by value or by const reference"
+        );
+
+        static constexpr auto deduce_result() noexcept
+        {
+            constexpr std::size_t first_typed = [] {
+                constexpr bool flags[] = {detail::is_typed_handler<Fs> ..., true};
+                std::size_t index = 0;
+                while (!flags[index])
+                    ++index;
+                return index;
+            }();
+            if constexpr (first_typed < size)
+                return std::type_identity<std::invoke_result_t<
+                    handler<first_typed> const &,
+                    detail::handled_type_t<handler<first_typed>> const &
+                >>{};
+            else if constexpr (has_fallback)
+                return std::type_identity<std::invoke_result_t<handler<fallback_index> const &, message const &>>{};
+            else
+                return std::type_identity<void>{};
+        }
+
+    public:
+        using result_type = typename decltype(deduce_result())::type;
+
+    private:
+        static_assert(
+            (detail::handler_returns<Fs, result_type> && ...),
+            "all handlers must return the same type"
+        );
+
+        static_assert(
+            has_fallback || std::is_void_v<result_type>,
+            "handlers that return a value need a fallback for unhandled messages"
+        );
+
+        using thunk = result_type (*)(handlers_type const &, message const &);
+
+        handlers_type _handlers;
+        thunk const *_table;
+        std::size_t _table_size;
+
+        template<std::size_t I>
+        static result_type invoke_handler(handlers_type const &handlers, message const &m)
+        {
+            using type = detail::handled_type_t<handler<I>>;
+            return std::invoke(std::get<I>(handlers), *static_cast<type const *>(m.data()));
+        }
+
+        static result_type invoke_fallback(handlers_type const &handlers, message const &m)
+        {
+            if constexpr (has_fallback)
+            {
+                static_assert(
+                    std::is_convertible_v<std::invoke_result_t<handler<fallback_index> const &, message const &>, result_type>,
+                    "the fallback must return a type convertible to the result of the handlers"
+                );
+                return std::invoke(std::get<fallback_index>(handlers), m);
+            }
+            else
+            {
+                nullsink<1>()(m);
+            }
+        }
+
+        template<std::size_t I>
+        static void register_handler(std::vector<thunk> &table)
+        {
+            if constexpr (detail::is_typed_handler<handler<I>>)
+            {
+                std::size_t const id = detail::assign_message_type_id<detail::handled_type_t<handler<I>>>();
+                if (id >= table.size())
+                    table.resize(id + 1, &invoke_fallback);
+                table[id] = &invoke_handler<I>;
+            }
+        }
+
+        // Entries of unhandled types below the largest handled id point to the fallback
+        static std::vector<thunk> const &table()
+        {
+            static std::vector<thunk> const table = [] {
+                std::vector<thunk> result;
+                [&]<std::size_t... Is>(std::index_sequence<Is ...>) {
+                    (register_handler<Is>(result), ...);
+                }(std::index_sequence_for<Fs ...>{});
+                return result;
+            }();
+            return table;
+        }
+
+    public:
+        template<typename T>
+        static constexpr bool handles = !std::is_void_v<T> && handler_index<std::remove_cvref_t<T>> < size;
+
+        explicit dispatcher(Fs... handlers)
+            : _handlers{std::move(handlers) ...}, _table{table().data()}, _table_size{table().size()} {}
+
+        /**
+         * Invokes the handler of the type of a message, or the fallback if no handler takes it.
+         */
+        result_type operator()(message const &m) const
+        {
+            std::size_t const type = m.type();
+            return (type < _table_size ? _table[type] : &invoke_fallback)(_handlers, m);
+        }
+
+        template<typename T>
+        requires (!std::is_same_v<std::remove_cvref_t<T>, message>)
+        result_type operator()(T const &value) const
+        {
+            return (*this)(message{value});
+        }
+    };
+}
+#endif //FUN_DISPATCHER_HPP
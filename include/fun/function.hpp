@@ -1,36 +1,38 @@
 #ifndef FUN_FUNCTION_HPP
 #define FUN_FUNCTION_HPP
 
-// Define special symbol for GCC compilers
-#if (defined(__GNUC__) || defined(__GNUG__)) && !defined(__clang__)
-#define FUN_GCC
-#endif
-
 #include <string_view>
-
-// Include GCC-specific name de-mangling header
-#ifdef FUN_GCC
-#include <cxxabi.h>
-#endif
-
 #include <fun/utility.hpp>
 
 namespace fun
 {
     namespace detail
     {
+        // Compiler-specific string describing this function, including its template argument
         template<typename T>
-        static auto *type_name()
+        constexpr std::string_view pretty_function() noexcept
         {
-            char const *name = typeid(T).name();
-#ifdef FUN_GCC
-            // De-mangling uses GCC-specific functions.
-        int error_code{};
-        char *demangled_name = abi::__cxa_demangle(name, nullptr, nullptr, &error_code);
-        if (!error_code)
-            name = demangled_name;
+#if defined(__clang__) || defined(__GNUC__)
+            return __PRETTY_FUNCTION__;
+#elif defined(_MSC_VER)
+            return __FUNCSIG__;
 #endif
-            return name;
+        }
+
+        // The position of a known type in its pretty function tells how to extract any other type name
+        inline constexpr std::string_view probe_pretty_function = pretty_function<void>();
+        inline constexpr std::size_t type_name_prefix = probe_pretty_function.find("void");
+        inline constexpr std::size_t type_name_suffix = probe_pretty_function.size() - type_name_prefix - 4;
+
+        /**
+         * Extracts the name of a type at compile time from the pretty name of a function template.
+         * The result refers to static storage, so no allocation is performed.
+         */
+        template<typename T>
+        constexpr std::string_view type_name() noexcept
+        {
+            constexpr std::string_view name = pretty_function<T>();
+            return name.substr(type_name_prefix, name.size() - type_name_prefix - type_name_suffix);
         }
     }
 
@@ -49,12 +51,12 @@ namespace fun
         Return (*_fptr)(Args ...) = nullptr;
 
     public:
-        [[nodiscard]] static std::string_view fptr_name() noexcept
+        [[nodiscard]] static constexpr std::string_view fptr_name() noexcept
         {
             return detail::type_name<Return (*)(Args ...)>();
-        };
+        }
 
-        [[nodiscard]] static std::string_view class_name() noexcept
+        [[nodiscard]] static constexpr std::string_view class_name() noexcept
         {
             return detail::type_name<function<Return(Args ...)>>();
         }
@@ -0,0 +1,108 @@
+#ifndef FUN_FUNCTION_REF_HPP
+#define FUN_FUNCTION_REF_HPP
+
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace fun
+{
+    template<typename Signature>
+    class function_ref;
+
+    /**
+     * Non-owning reference to any callable object, made of two pointers and trivially copyable.
+     * The referenced callable must outlive the function_ref.
+     * Function pointers of the exact signature and empty callables, such as lambdas without captures,
+     * can also be invoked in constant expressions. Stateful callables cannot, since that requires
+     * a cast from a void pointer.
+     *
+     * @tparam Return   The return type of the function
+     * @tparam Args     The parameters of the function
+     */
+    template<typename Return, typename... Args>
+    class function_ref<Return(Args ...)>
+    {
+        union storage
+        {
+            void const *object;
+            void (*function)();
+            Return (*exact)(Args ...);
+        };
+
+        using invoker = Return (*)(storage, Args &&...);
+
+        storage _storage;
+        invoker _invoker;
+
+        template<typename F>
+        static constexpr Return call(F &f, Args &&... args)
+        {
+            if constexpr (std::is_void_v<Return>)
+                std::invoke(f, std::forward<Args>(args) ...);
+            else
+                return std::invoke(f, std::forward<Args>(args) ...);
+        }
+
+        template<typename F>
+        static constexpr Return invoke_object(storage s, Args &&... args)
+        {
+            if constexpr (std::is_empty_v<F> && std::is_default_constructible_v<std::remove_cv_t<F>>)
+            {
+                // Empty callables have no state, so an equivalent object replaces the one behind the void pointer
+                if (std::is_constant_evaluated())
+                {
+                    F f{};
+                    return call(f, std::forward<Args>(args) ...);
+                }
+            }
+            return call(*static_cast<F *>(const_cast<void *>(s.object)), std::forward<Args>(args) ...);
+        }
+
+        static constexpr Return invoke_exact(storage s, Args &&... args)
+        {
+            return s.exact(std::forward<Args>(args) ...);
+        }
+
+        template<typename F>
+        static Return invoke_function(storage s, Args &&... args)
+        {
+            auto const f = reinterpret_cast<F *>(s.function);
+            if constexpr (std::is_void_v<Return>)
+                std::invoke(f, std::forward<Args>(args) ...);
+            else
+                return std::invoke(f, std::forward<Args>(args) ...);
+        }
+
+    public:
+        template<typename F, typename T = std::remove_reference_t<F>>
+        requires (
+            !std::is_same_v<std::remove_cv_t<T>, function_ref> &&
+            !std::is_function_v<std::remove_pointer_t<T>> &&
+            std::is_invocable_r_v<Return, T &, Args ...>
+        )
+        constexpr function_ref(F &&f) noexcept
+            : _storage{.object = std::addressof(f)}, _invoker{&invoke_object<T>} {}
+
+        constexpr function_ref(Return (*f)(Args ...)) noexcept : _storage{.exact = f}, _invoker{&invoke_exact} {}
+
+        template<typename F>
+        requires std::is_function_v<F> && std::is_invocable_r_v<Return, F *, Args ...>
+        function_ref(F *f) noexcept
+            : _storage{.function = reinterpret_cast<void (*)()>(f)}, _invoker{&invoke_function<F>} {}
+
+        constexpr function_ref(function_ref const &other) noexcept = default;
+
+        constexpr function_ref &operator=(function_ref const &other) noexcept = default;
+
+        constexpr Return operator()(Args... args) const
+        {
+            return _invoker(_storage, std::forward<Args>(args) ...);
+        }
+    };
+
+    template<typename Return, typename... Args>
+    function_ref(Return (*)(Args ...)) -> function_ref<Return(Args ...)>;
+}
+#endif //FUN_FUNCTION_REF_HPP
@@ -0,0 +1,218 @@
+#ifndef FUN_INPLACE_FUNCTION_HPP
+#define FUN_INPLACE_FUNCTION_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace fun
+{
+    // Default number of bytes available for storing a callable inside an inplace_function
+    inline constexpr std::size_t inplace_capacity = 4 * sizeof(void *);
+
+    namespace detail
+    {
+        enum class inplace_operation
+        {
+            move,
+            destroy
+        };
+
+        // Callables that can be moved with std::memcpy and need no destructor call
+        template<typename F>
+        inline constexpr bool is_trivially_relocatable_v =
+            std::is_trivially_copyable_v<F> && std::is_trivially_destructible_v<F>;
+
+        // Callables that fit in the inplace storage and can be moved out of it without throwing
+        template<typename F, std::size_t Capacity, std::size_t Alignment>
+        concept inplace_storable = sizeof(F) <= Capacity && Alignment % alignof(F) == 0
+                                && std::is_nothrow_move_constructible_v<F>;
+    }
+
+    template<typename Signature, std::size_t Capacity = inplace_capacity, std::size_t Alignment = alignof(std::max_align_t)>
+    class inplace_function;
+
+    /**
+     * Move-only type-erased wrapper over any callable object, stored inside the wrapper without heap allocations.
+     * Callables that are trivially copyable are relocated with std::memcpy and do not need a manager function.
+     * Like std::function, the stored callable is invoked as a non-const lvalue.
+     *
+     * @tparam Return       The return type of the function
+     * @tparam Args         The parameters of the function
+     * @tparam Capacity     The maximum size of the stored callable
+     * @tparam Alignment    The maximum alignment of the stored callable
+     */
+    template<typename Return, typename... Args, std::size_t Capacity, std::size_t Alignment>
+    class inplace_function<Return(Args ...), Capacity, Alignment>
+    {
+        using invoker = Return (*)(void *, Args &&...);
+        using manager = void (*)(detail::inplace_operation, void *, void *) noexcept;
+
+        alignas(Alignment) mutable std::byte _storage[Capacity];
+        invoker _invoker = &invoke_empty;
+        manager _manager = nullptr;
+
+        [[noreturn]] static Return invoke_empty(void *, Args &&...)
+        {
+            throw std::bad_function_call{};
+        }
+
+        template<typename F>
+        static Return invoke(void *storage, Args &&... args)
+        {
+            if constexpr (std::is_void_v<Return>)
+                std::invoke(*static_cast<F *>(storage), std::forward<Args>(args) ...);
+            else
+                return std::invoke(*static_cast<F *>(storage), std::forward<Args>(args) ...);
+        }
+
+        template<typename F>
+        static void manage(detail::inplace_operation operation, void *destination, void *source) noexcept
+        {
+            switch (operation)
+            {
+                case detail::inplace_operation::move:
+                    ::new (destination) F(std::move(*static_cast<F *>(source)));
+                    static_cast<F *>(source)->~F();
+                    break;
+                case detail::inplace_operation::destroy:
+                    static_cast<F *>(destination)->~F();
+                    break;
+            }
+        }
+
+        void move_from(inplace_function &other) noexcept
+        {
+            if (other._manager)
+                other._manager(detail::inplace_operation::move, _storage, other._storage);
+            else
+                std::memcpy(_storage, other._storage, Capacity);
+            _invoker = std::exchange(other._invoker, &invoke_empty);
+            _manager = std::exchange(other._manager, nullptr);
+        }
+
+        void reset() noexcept
+        {
+            if (_manager)
+                _manager(detail::inplace_operation::destroy, _storage, nullptr);
+            _invoker = &invoke_empty;
+            _manager = nullptr;
+        }
+
+    public:
+        inplace_function() noexcept = default;
+
+        inplace_function(std::nullptr_t) noexcept {}
+
+        /**
+         * Whether a callable can be stored, which is checked with a static_assert when constructing
+         * the wrapper rather than in its constraints, so that oversized callables get a clear diagnostic.
+         */
+        template<typename F>
+        static constexpr bool can_store = detail::inplace_storable<std::decay_t<F>, Capacity, Alignment>;
+
+        template<typename F, typename D = std::decay_t<F>>
+        requires (!std::is_same_v<D, inplace_function> && std::is_invocable_r_v<Return, D &, Args ...>)
+        inplace_function(F &&f) noexcept(std::is_nothrow_constructible_v<D, F &&>)
+        {
+            static_assert(
+                detail::inplace_storable<D, Capacity, Alignment>,
+                "callable must fit in the inplace storage and be nothrow move constructible"
+            );
+
+            if constexpr (std::is_pointer_v<D> || std::is_member_pointer_v<D>)
+            {
+                if (f == nullptr)
+                    return;
+            }
+
+            ::new (static_cast<void *>(_storage)) D(std::forward<F>(f));
+            _invoker = &invoke<D>;
+            if constexpr (!detail::is_trivially_relocatable_v<D>)
+                _manager = &manage<D>;
+        }
+
+        inplace_function(inplace_function const &) = delete;
+
+        inplace_function(inplace_function &&other) noexcept
+        {
+            move_from(other);
+        }
+
+        ~inplace_function()
+        {
+            reset();
+        }
+
+        inplace_function &operator=(inplace_function const &) = delete;
+
+        inplace_function &operator=(inplace_function &&other) noexcept
+        {
+            if (this == &other)
+                return *this;
+            reset();
+            move_from(other);
+            return *this;
+        }
+
+        inplace_function &operator=(std::nullptr_t) noexcept
+        {
+            reset();
+            return *this;
+        }
+
+        template<typename F>
+        requires std::is_constructible_v<inplace_function, F &&>
+        inplace_function &operator=(F &&f)
+        {
+            return *this = inplace_function{std::forward<F>(f)};
+        }
+
+        void swap(inplace_function &other) noexcept
+        {
+            inplace_function temp{std::move(other)};
+            other = std::move(*this);
+            *this = std::move(temp);
+        }
+
+        [[nodiscard]] explicit operator bool() const noexcept
+        {
+            return _invoker != &invoke_empty;
+        }
+
+        /**
+         * Invokes the stored callable.
+         *
+         * @throws std::bad_function_call   If no callable is stored
+         */
+        Return operator()(Args... args) const
+        {
+            return _invoker(_storage, std::forward<Args>(args) ...);
+        }
+    };
+
+    template<typename Return, typename... Args>
+    inplace_function(Return (*)(Args ...)) -> inplace_function<Return(Args ...)>;
+
+    /**
+     * Aliases of the common function shapes, stored in an inplace_function with the default capacity.
+     */
+    namespace inplace
+    {
+        template<typename... Args>
+        using action = inplace_function<void(Args ...)>;
+
+        template<typename T, typename U>
+        using comparator = inplace_function<bool(T, U)>;
+
+        template<typename T>
+        using predicate = inplace_function<bool(T)>;
+
+        template<typename Return, typename T = Return>
+        using transform = inplace_function<Return(T)>;
+    }
+}
+#endif //FUN_INPLACE_FUNCTION_HPP
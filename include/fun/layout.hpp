@@ -0,0 +1,277 @@
+#ifndef FUN_LAYOUT_HPP
+#define FUN_LAYOUT_HPP
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <iomanip>
+#include <memory>
+#include <ostream>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <fun/function.hpp>
+#include <fun/member_pointer.hpp>
+#include <fun/reflect.hpp>
+
+namespace fun
+{
+    namespace detail
+    {
+        [[nodiscard]] constexpr std::size_t align_up(std::size_t offset, std::size_t alignment) noexcept
+        {
+            return (offset + alignment - 1) / alignment * alignment;
+        }
+
+        // Object that is never defined, whose members are only compared by address in constant expressions
+        template<typename C>
+        extern C const layout_probe;
+
+        // Members declared later have higher addresses, whatever their access
+        template<auto Ptr, auto Next>
+        [[nodiscard]] constexpr bool declared_before() noexcept
+        {
+            using class_type = member_class_t<Ptr>;
+            return static_cast<void const *>(std::addressof(layout_probe<class_type>.*Ptr))
+                 < static_cast<void const *>(std::addressof(layout_probe<class_type>.*Next));
+        }
+
+        template<auto... Ptrs>
+        [[nodiscard]] constexpr bool in_declaration_order() noexcept
+        {
+            constexpr std::tuple ptrs{Ptrs ...};
+            return [&]<std::size_t... Indices>(std::index_sequence<Indices ...>) {
+                return (declared_before<std::get<Indices>(ptrs), std::get<Indices + 1>(ptrs)>() && ...);
+            }(std::make_index_sequence<sizeof... (Ptrs) - 1>{});
+        }
+
+        // Members that fit in the tail padding do not change the size, so aggregates also have their fields counted
+        template<typename C>
+        [[nodiscard]] constexpr bool has_field_count(std::size_t count) noexcept
+        {
+            if constexpr (reflectable<C>)
+                return field_count<C> == count;
+            else
+                return true;
+        }
+    }
+
+    /**
+     * Placement of a single data member inside of its class.
+     */
+    struct field_layout
+    {
+        std::size_t index = 0;      // Position of the member pointer in the audited list
+        std::size_t offset = 0;
+        std::size_t size = 0;
+        std::size_t alignment = 0;
+        std::size_t padding = 0;    // Unused bytes between the previous field and this one
+        std::string_view type{};
+    };
+
+    /**
+     * Layout of a class described by a list of its data members, sorted by offset.
+     * Wasted bytes are all bytes of the class that are not covered by the listed members.
+     * The optimal order sorts members by decreasing alignment, which leaves no padding between them.
+     *
+     * @tparam N    The number of listed members
+     */
+    template<std::size_t N>
+    struct layout_report
+    {
+        std::string_view name{};
+        std::size_t size = 0;
+        std::size_t alignment = 0;
+        std::array<field_layout, N> fields{};
+        std::size_t tail_padding = 0;
+        std::size_t wasted_bytes = 0;
+        std::array<std::size_t, N> optimal_order{};
+        std::size_t optimal_size = 0;
+
+        [[nodiscard]] constexpr bool can_shrink() const noexcept
+        {
+            return optimal_size < size;
+        }
+
+        friend std::ostream &operator<<(std::ostream &out, layout_report const &report)
+        {
+            out << report.name << ": " << report.size << " bytes, " << report.wasted_bytes << " wasted";
+            if (report.can_shrink())
+                out << ", could be " << report.optimal_size << " bytes";
+            out << "\n  offset  size  align  type\n";
+            for (auto const &field : report.fields)
+            {
+                if (field.padding > 0)
+                    out << "  " << std::setw(6) << field.offset - field.padding << "  (" << field.padding << " bytes of padding)\n";
+                out << "  " << std::setw(6) << field.offset << "  " << std::setw(4) << field.size << "  "
+                    << std::setw(5) << field.alignment << "  [" << field.index << "] " << field.type << '\n';
+            }
+            if (report.tail_padding > 0)
+                out << "  " << std::setw(6) << report.size - report.tail_padding << "  (" << report.tail_padding << " bytes of tail padding)\n";
+            if (report.can_shrink())
+            {
+                out << "  suggested order:";
+                for (std::size_t const index : report.optimal_order)
+                    out << " [" << index << ']';
+                out << '\n';
+            }
+            return out;
+        }
+    };
+
+    namespace detail
+    {
+        template<std::size_t N>
+        constexpr layout_report<N> make_layout_report(
+            std::string_view name,
+            std::size_t size,
+            std::size_t alignment,
+            std::array<field_layout, N> fields
+        )
+        {
+            layout_report<N> report{.name = name, .size = size, .alignment = alignment};
+
+            // Insertion sorts are stable and cheap for the few members of a class
+            for (std::size_t i = 1; i < N; ++i)
+                for (std::size_t j = i; j > 0 && fields[j].offset < fields[j - 1].offset; --j)
+                    std::swap(fields[j], fields[j - 1]);
+
+            std::size_t end = 0;
+            std::size_t used = 0;
+            for (auto &field : fields)
+            {
+                field.padding = field.offset > end ? field.offset - end : 0;
+                end = field.offset + field.size > end ? field.offset + field.size : end;
+                used += field.size;
+            }
+            report.fields = fields;
+            report.tail_padding = size > end ? size - end : 0;
+            report.wasted_bytes = size - used;
+
+            std::array<std::size_t, N> alignments{};
+            for (auto const &field : fields)
+                alignments[field.index] = field.alignment;
+            for (std::size_t i = 0; i < N; ++i)
+                report.optimal_order[i] = i;
+            for (std::size_t i = 1; i < N; ++i)
+                for (std::size_t j = i; j > 0 && alignments[report.optimal_order[j]] > alignments[report.optimal_order[j - 1]]; --j)
+                    std::swap(report.optimal_order[j], report.optimal_order[j - 1]);
+
+            report.optimal_size = align_up(used, alignment);
+            return report;
+        }
+    }
+
+    /**
+     * Compile-time layout of a class, computed from a list of all of its data members in declaration order.
+     * The offsets are predicted with the usual rules for standard layout classes, and the prediction is only
+     * complete when it matches the size of the class and the members are listed in declaration order.
+     * The fields of aggregates are also counted, but a missing member of another class goes unnoticed
+     * when it fits in the tail padding. Use measure_layout to check the actual offsets at runtime.
+     *
+     * @tparam Ptrs The pointers to the data members, in declaration order
+     */
+    template<auto Ptr, auto... Ptrs>
+    requires std::is_member_object_pointer_v<decltype(Ptr)> && (std::is_member_object_pointer_v<decltype(Ptrs)> && ...)
+          && (std::is_same_v<detail::member_class_t<Ptr>, detail::member_class_t<Ptrs>> && ...)
+    struct struct_layout
+    {
+        using class_type = detail::member_class_t<Ptr>;
+
+        static constexpr std::size_t member_count = sizeof... (Ptrs) + 1;
+
+        static constexpr std::size_t predicted_size = [] {
+            std::size_t offset = 0;
+            ((offset = detail::align_up(offset, alignof(detail::member_type_t<Ptr>)) + sizeof(detail::member_type_t<Ptr>)), ...,
+             (offset = detail::align_up(offset, alignof(detail::member_type_t<Ptrs>)) + sizeof(detail::member_type_t<Ptrs>)));
+            return detail::align_up(offset, alignof(class_type));
+        }();
+
+        // Whether the listed members account for the whole class, in declaration order
+        static constexpr bool complete = predicted_size == sizeof(class_type)
+            && detail::in_declaration_order<Ptr, Ptrs ...>() && detail::has_field_count<class_type>(member_count);
+
+        static constexpr layout_report<member_count> value = [] {
+            std::array<field_layout, member_count> fields{
+                field_layout{
+                    .size = sizeof(detail::member_type_t<Ptr>),
+                    .alignment = alignof(detail::member_type_t<Ptr>),
+                    .type = detail::type_name<detail::member_type_t<Ptr>>()
+                },
+                field_layout{
+                    .size = sizeof(detail::member_type_t<Ptrs>),
+                    .alignment = alignof(detail::member_type_t<Ptrs>),
+                    .type = detail::type_name<detail::member_type_t<Ptrs>>()
+                } ...
+            };
+            std::size_t offset = 0;
+            for (std::size_t i = 0; i < member_count; ++i)
+            {
+                fields[i].index = i;
+                fields[i].offset = detail::align_up(offset, fields[i].alignment);
+                offset = fields[i].offset + fields[i].size;
+            }
+            return detail::make_layout_report(
+                detail::type_name<class_type>(),
+                sizeof(class_type),
+                alignof(class_type),
+                fields
+            );
+        }();
+    };
+
+    template<typename Pointers, std::size_t MaxWasted>
+    struct audit_layout;
+
+    /**
+     * Checks at compile time that a sequence of member pointers lists all data members of a class in declaration
+     * order, and that the class does not waste more than a given number of bytes on padding.
+     * An explicit instantiation can also audit private members.
+     *
+     * @tparam Ptrs         The pointers to the data members, in declaration order
+     * @tparam MaxWasted    The largest number of padding bytes allowed
+     */
+    template<auto... Ptrs, std::size_t MaxWasted>
+    struct audit_layout<member_pointers<Ptrs ...>, MaxWasted>
+    {
+        using layout = struct_layout<Ptrs ...>;
+
+        static_assert(layout::complete, "the member pointers must list all data members in declaration order");
+        static_assert(layout::value.wasted_bytes <= MaxWasted, "the class wastes too many bytes on padding");
+    };
+
+    /**
+     * Measures the layout of a class at runtime, using the actual offsets of its data members
+     * inside of a value-initialized object.
+     *
+     * @tparam C    The class that contains the members
+     * @tparam Ms   The types of the members
+     * @param ptrs  The pointers to the members, in any order
+     * @return      The layout of the class
+     */
+    template<std::default_initializable C, typename... Ms>
+    [[nodiscard]] layout_report<sizeof... (Ms)> measure_layout(Ms C::*... ptrs)
+    {
+        C const obj{};
+        auto const offset_of = [&](auto ptr) {
+            return static_cast<std::size_t>(
+                reinterpret_cast<std::byte const *>(std::addressof(obj.*ptr)) -
+                reinterpret_cast<std::byte const *>(std::addressof(obj))
+            );
+        };
+
+        std::size_t index = 0;
+        std::array<field_layout, sizeof... (Ms)> fields{
+            field_layout{
+                .index = index++,
+                .offset = offset_of(ptrs),
+                .size = sizeof(Ms),
+                .alignment = alignof(Ms),
+                .type = detail::type_name<Ms>()
+            } ...
+        };
+        return detail::make_layout_report(detail::type_name<C>(), sizeof(C), alignof(C), fields);
+    }
+}
+#endif //FUN_LAYOUT_HPP
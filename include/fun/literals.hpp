@@ -73,6 +73,12 @@ namespace fun
         {
             return tag<detail::parse({Chars ...})>{};
         }
+
+        template<fixed_string Str>
+        constexpr auto operator ""_s() noexcept
+        {
+            return string_tag<Str>{};
+        }
     }
 }
 #endif //FUN_LITERALS_HPP
\ No newline at end of file
@@ -0,0 +1,234 @@
+#ifndef FUN_MATCH_ALL_HPP
+#define FUN_MATCH_ALL_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <ranges>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+#include <fun/dispatch.hpp>
+#include <fun/overload.hpp>
+
+namespace fun
+{
+    /**
+     * Options of match_all, which can be combined with operator|.
+     */
+    enum class match_mode : unsigned
+    {
+        unordered = 0,  // Results are grouped by alternative
+        ordered = 1,    // Results are stored in the order of the matched elements
+        parallel = 2    // Buckets are split into chunks that are matched by several threads
+    };
+
+    [[nodiscard]] constexpr match_mode operator|(match_mode lhs, match_mode rhs) noexcept
+    {
+        return static_cast<match_mode>(static_cast<unsigned>(lhs) | static_cast<unsigned>(rhs));
+    }
+
+    namespace detail
+    {
+        [[nodiscard]] constexpr bool has_mode(match_mode modes, match_mode mode) noexcept
+        {
+            return (static_cast<unsigned>(modes) & static_cast<unsigned>(mode)) != 0;
+        }
+
+        template<typename R>
+        concept variant_range = std::ranges::random_access_range<R> && std::ranges::sized_range<R>
+            && is_variant_v<std::ranges::range_value_t<R>>;
+
+        template<typename R, std::size_t I>
+        using bucket_alternative_t = decltype(get_alternative<I>(std::declval<std::ranges::range_reference_t<R>>()));
+
+        // Elements of a bucket matched by a single thread at a time
+        inline constexpr std::size_t match_chunk_size = 4096;
+
+        /**
+         * Positions of the elements of a range, grouped by the index of their alternative with a counting sort.
+         * The positions of alternative I are stored between offsets[I] and offsets[I + 1], in increasing order.
+         */
+        template<std::size_t Size>
+        struct variant_buckets
+        {
+            std::array<std::size_t, Size + 1> offsets{};
+            std::vector<std::size_t> positions;
+
+            template<typename R>
+            constexpr explicit variant_buckets(R &range)
+            {
+                auto const first = std::ranges::begin(range);
+                std::size_t const size = std::ranges::size(range);
+                for (std::size_t pos = 0; pos < size; ++pos)
+                {
+                    if (first[pos].valueless_by_exception())
+                        throw std::bad_variant_access{};
+                    ++offsets[first[pos].index() + 1];
+                }
+                for (std::size_t i = 1; i <= Size; ++i)
+                    offsets[i] += offsets[i - 1];
+
+                positions.resize(size);
+                std::array<std::size_t, Size + 1> next = offsets;
+                for (std::size_t pos = 0; pos < size; ++pos)
+                    positions[next[first[pos].index()]++] = pos;
+            }
+        };
+
+        // Results are written through a random access iterator, or discarded when it is nullptr
+        template<match_mode Mode, std::size_t I, typename F, typename R, typename Results>
+        constexpr void match_bucket(F &f, R &range, std::size_t const *positions, std::size_t first, std::size_t last, Results results)
+        {
+            auto const elements = std::ranges::begin(range);
+            for (std::size_t j = first; j < last; ++j)
+            {
+                auto &&alternative = get_alternative<I>(elements[positions[j]]);
+                if constexpr (std::is_null_pointer_v<Results>)
+                    std::invoke(f, alternative);
+                else
+                    results[has_mode(Mode, match_mode::ordered) ? positions[j] : j] = std::invoke(f, alternative);
+            }
+        }
+
+        struct match_task
+        {
+            std::size_t alternative;
+            std::size_t first;
+            std::size_t last;
+        };
+
+        /**
+         * Matches chunks of all buckets on a pool of threads, including the calling one.
+         * The first exception thrown by a matcher is rethrown after all threads are done.
+         * If a thread cannot be started, the started ones stop taking tasks and are joined before the error is rethrown.
+         */
+        template<match_mode Mode, std::size_t Size, typename F, typename R, typename Results>
+        void match_buckets_parallel(F &f, R &range, variant_buckets<Size> const &buckets, Results results)
+        {
+            std::vector<match_task> tasks;
+            for (std::size_t i = 0; i < Size; ++i)
+                for (std::size_t first = buckets.offsets[i]; first < buckets.offsets[i + 1]; first += match_chunk_size)
+                    tasks.push_back({i, first, std::min(first + match_chunk_size, buckets.offsets[i + 1])});
+
+            std::atomic<std::size_t> next_task = 0;
+            std::vector<std::exception_ptr> errors(std::max<std::size_t>(std::thread::hardware_concurrency(), 1));
+            errors.resize(std::min(errors.size(), tasks.size()));
+
+            auto const work = [&](std::exception_ptr &error) noexcept {
+                try
+                {
+                    for (std::size_t t = next_task++; t < tasks.size(); t = next_task++)
+                    {
+                        visit_index<void, Size>(tasks[t].alternative, [&]<std::size_t I>() {
+                            match_bucket<Mode, I>(f, range, buckets.positions.data(), tasks[t].first, tasks[t].last, results);
+                        });
+                    }
+                }
+                catch (...)
+                {
+                    error = std::current_exception();
+                    next_task = tasks.size();
+                }
+            };
+
+            if (errors.empty())
+                return;
+
+            std::vector<std::thread> threads;
+            auto const join = [&]() noexcept {
+                for (auto &thread : threads)
+                    thread.join();
+            };
+
+            // Threads that were started must be joined even if starting another one fails
+            try
+            {
+                threads.reserve(errors.size() - 1);
+                for (std::size_t i = 1; i < errors.size(); ++i)
+                    threads.emplace_back(work, std::ref(errors[i]));
+            }
+            catch (...)
+            {
+                next_task = tasks.size();
+                join();
+                throw;
+            }
+            work(errors[0]);
+            join();
+
+            for (auto const &error : errors)
+                if (error)
+                    std::rethrow_exception(error);
+        }
+    }
+
+    /**
+     * Matches every variant in a range against a list of functions, calling each function in a tight loop
+     * over all elements that hold its alternative. The elements are first grouped by alternative with
+     * a counting sort, so the dispatch happens once per alternative instead of once per element.
+     * Functions are invoked alternative by alternative, in the order of the elements within each alternative.
+     * If the functions return a value, the results are returned in a vector, grouped by alternative
+     * unless match_mode::ordered is given. With match_mode::parallel, the functions are also invoked
+     * concurrently from several threads.
+     * Matching a range that contains a valueless variant throws std::bad_variant_access before invoking anything.
+     *
+     * @tparam Mode The options used for matching
+     * @param range The range of variants, which must be random access
+     * @param fs    The functions used to match the alternatives
+     * @return      Nothing if the functions return void, otherwise a vector with all results
+     */
+    template<match_mode Mode = match_mode::unordered, detail::variant_range R, traits::callable... Fs>
+    requires (sizeof... (Fs) > 0)
+    constexpr auto match_all(R &&range, Fs &&... fs)
+    {
+        constexpr std::size_t size = detail::variant_size_v<std::ranges::range_value_t<R>>;
+        auto f = overload(std::forward<Fs>(fs) ...);
+
+        using result = std::invoke_result_t<decltype(f) &, detail::bucket_alternative_t<R, 0>>;
+        static_assert(
+            [&]<std::size_t... Is>(std::index_sequence<Is ...>) {
+                return (std::is_same_v<std::invoke_result_t<decltype(f) &, detail::bucket_alternative_t<R, Is>>, result> && ...);
+            }(std::make_index_sequence<size>{}),
+            "all matchers must return the same type"
+        );
+        static_assert(std::is_void_v<result> || std::is_default_constructible_v<result>, "results must be default constructible");
+        static_assert(
+            !detail::has_mode(Mode, match_mode::parallel) || !std::is_same_v<result, bool>,
+            "std::vector<bool> cannot be written from several threads"
+        );
+
+        detail::variant_buckets<size> const buckets{range};
+        auto run = [&](auto results) {
+            if constexpr (detail::has_mode(Mode, match_mode::parallel))
+            {
+                detail::match_buckets_parallel<Mode>(f, range, buckets, results);
+            }
+            else
+            {
+                [&]<std::size_t... Is>(std::index_sequence<Is ...>) {
+                    (detail::match_bucket<Mode, Is>(
+                        f, range, buckets.positions.data(), buckets.offsets[Is], buckets.offsets[Is + 1], results
+                    ), ...);
+                }(std::make_index_sequence<size>{});
+            }
+        };
+
+        if constexpr (std::is_void_v<result>)
+        {
+            run(nullptr);
+        }
+        else
+        {
+            std::vector<result> results(buckets.positions.size());
+            run(results.begin());
+            return results;
+        }
+    }
+}
+#endif //FUN_MATCH_ALL_HPP
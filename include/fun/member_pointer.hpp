@@ -2,7 +2,11 @@
 #define FUN_MEMBER_POINTER_HPP
 
 #include <concepts>
+#include <cstddef>
+#include <functional>
+#include <tuple>
 #include <type_traits>
+#include <utility>
 #include <fun/overload.hpp>
 
 namespace fun
@@ -15,29 +19,153 @@ namespace fun
         T::ptr = ptr;
     };
 
+    // Key of the friend function that returns the member pointer enabled for an accessor type
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wnon-template-friend"
+#endif
+    template<typename Accessor>
+    struct access_key
+    {
+        friend constexpr auto accessed_ptr_impl(access_key) noexcept;
+    };
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
     /**
      * An explicit instantion of this template enables access to a (possibly private) member pointer
-     * through a mutable static member of a given type.
+     * through a given type, which can be any tag. The pointer is then available as the compile-time
+     * constant accessed_ptr<Accessor>, so accessing a member through it compiles to a direct load.
+     * Each accessor type can enable a single member pointer.
      *
      * @tparam Ptr      The member pointer to access
      * @tparam Accessor The type through which the pointer will be accessed
      */
-    template<member_pointer auto Ptr, member_pointer_accessor<decltype(Ptr)> Accessor>
+    template<member_pointer auto Ptr, typename Accessor>
     struct enable_access
+    {
+        friend constexpr auto accessed_ptr_impl(access_key<Accessor>) noexcept
+        {
+            return Ptr;
+        }
+    };
+
+    /**
+     * Accessors with a mutable static member named ptr also receive the pointer during dynamic initialization.
+     * Accesses through Accessor::ptr cannot be constant-folded, so accessed_ptr<Accessor> should be preferred.
+     */
+    template<member_pointer auto Ptr, typename Accessor>
+    requires member_pointer_accessor<Accessor, decltype(Ptr)>
+    struct enable_access<Ptr, Accessor>
     {
         static inline auto const ptr = Accessor::ptr = Ptr;
+
+        friend constexpr auto accessed_ptr_impl(access_key<Accessor>) noexcept
+        {
+            return Ptr;
+        }
     };
 
+    /**
+     * The member pointer enabled for an accessor type by an explicit instantiation of enable_access,
+     * usable in constant expressions and during static initialization.
+     *
+     * @tparam Accessor The type through which the pointer is accessed
+     */
+    template<typename Accessor>
+    inline constexpr auto accessed_ptr = accessed_ptr_impl(access_key<Accessor>{});
+
     template<typename V, typename... Ptrs>
     concept visitor = (std::invocable<V, Ptrs> && ...);
 
+    // Key of the friend function that returns the member pointers registered for a class
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wnon-template-friend"
+#endif
+    template<typename C>
+    struct member_pointers_key
+    {
+        friend constexpr auto member_pointers_of_impl(member_pointers_key) noexcept;
+    };
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+    namespace detail
+    {
+        template<typename>
+        struct data_member_traits;
+
+        template<typename M, typename C>
+        struct data_member_traits<M C::*>
+        {
+            using class_type = C;
+            using member_type = M;
+        };
+
+        template<auto Ptr>
+        using member_class_t = typename data_member_traits<decltype(Ptr)>::class_type;
+
+        template<auto Ptr>
+        using member_type_t = typename data_member_traits<decltype(Ptr)>::member_type;
+
+        template<auto Ptr, auto...>
+        struct first_member_class : std::type_identity<member_class_t<Ptr>> {};
+    }
+
     /**
      * Explicit instantions of this template's inner metafunctions allow performing actions on
      * a sequence of (possibly private) member pointers.
+     * The access, visit and match metafunctions invoke their callables during dynamic initialization.
+     * The static functions apply, for_each and match_each do the same on demand, and can also be evaluated
+     * at compile time, while the registered metafunction makes the whole sequence available by class name.
      */
     template<member_pointer auto... Ptrs>
     struct member_pointers
     {
+        static constexpr std::size_t size = sizeof... (Ptrs);
+
+        static constexpr std::tuple<decltype(Ptrs) ...> pointers{Ptrs ...};
+
+        /**
+         * Invokes a callable with all member pointers in the sequence as parameters.
+         *
+         * @param f The callable that accepts the entire sequence of member pointers
+         * @return  The result of the call
+         */
+        template<std::invocable<decltype(Ptrs) ...> F>
+        static constexpr decltype(auto) apply(F &&f)
+        {
+            return std::invoke(std::forward<F>(f), Ptrs ...);
+        }
+
+        /**
+         * Invokes a visitor once on every member pointer in the sequence, in order.
+         *
+         * @param v The visitor that accepts any member pointer in the sequence
+         */
+        template<visitor<decltype(Ptrs) ...> V>
+        static constexpr void for_each(V &&v)
+        {
+            (std::invoke(v, Ptrs), ...);
+        }
+
+        /**
+         * Matches each member pointer in the sequence with exactly one of the given functions,
+         * according to function overloading rules.
+         *
+         * @param fs    The functions whose overload set accepts any member pointer in the sequence
+         */
+        template<typename... Fs>
+        requires visitor<decltype(overload(std::declval<Fs>() ...)), decltype(Ptrs) ...>
+        static constexpr void match_each(Fs &&... fs)
+        {
+            auto const overloaded = overload(std::forward<Fs>(fs) ...);
+            (overloaded(Ptrs), ...);
+        }
+
         /**
          * Invokes a callable, passing all member pointers in the list to it as parameters.
          *
@@ -75,6 +203,31 @@ namespace fun
             static constexpr auto overloaded = overload(Matchers ...);
             [[maybe_unused]] static inline auto const _ = (overloaded(Ptrs), ..., std::type_identity<void>{});
         };
+
+        /**
+         * Registers the sequence for the class of its first member pointer, which is then available as
+         * member_pointers_of<C>. Registration happens at compile time and runs no code at startup,
+         * so registered pointers can be used from any translation unit, in any order.
+         * Each class can have a single registered sequence.
+         */
+        struct registered
+        {
+            using class_type = typename detail::first_member_class<Ptrs ...>::type;
+
+            friend constexpr auto member_pointers_of_impl(member_pointers_key<class_type>) noexcept
+            {
+                return member_pointers{};
+            }
+        };
     };
+
+    /**
+     * The sequence of member pointers registered for a class with an explicit instantiation
+     * of member_pointers<Ptrs...>::registered, which can also refer to private members.
+     *
+     * @tparam C    The class whose member pointers were registered
+     */
+    template<typename C>
+    using member_pointers_of = decltype(member_pointers_of_impl(member_pointers_key<C>{}));
 }
 #endif //FUN_MEMBER_POINTER_HPP
\ No newline at end of file
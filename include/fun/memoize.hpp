@@ -0,0 +1,209 @@
+#ifndef FUN_MEMOIZE_HPP
+#define FUN_MEMOIZE_HPP
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <fun/traits.hpp>
+#include <fun/utility.hpp>
+
+namespace fun
+{
+    // Default number of independently locked shards in the cache of a memoized function
+    inline constexpr std::size_t memoize_shards = 16;
+
+    namespace detail
+    {
+        // Assumed size of a cache line, used to keep shards from sharing one
+        inline constexpr std::size_t cache_line_size = 64;
+
+        struct tuple_hash
+        {
+            template<typename... Ts>
+            [[nodiscard]] std::size_t operator()(std::tuple<Ts ...> const &values) const noexcept
+            {
+                return std::apply(
+                    [](Ts const &... xs) {
+                        std::size_t seed = 0;
+                        ((seed = hash_combine(seed, std::hash<Ts>{}(xs))), ...);
+                        return seed;
+                    },
+                    values
+                );
+            }
+        };
+
+        // Signature of a callable with a single call operator, without its noexcept specifier
+        template<typename F>
+        using deduced_signature = typename traits::signature_of<F>::type;
+    }
+
+    /**
+     * Statistics about the cache of a memoized function.
+     */
+    struct memoize_stats
+    {
+        std::size_t hits = 0;
+        std::size_t misses = 0;
+        std::size_t size = 0;
+    };
+
+    template<typename Signature, typename F, std::size_t Shards = memoize_shards>
+    class memoized;
+
+    /**
+     * Callable which caches the results of a pure function, keyed by its arguments.
+     * The cache is split into shards, each guarded by its own mutex, so that threads calling the function
+     * with different arguments rarely contend. The function itself is invoked without holding any lock.
+     * Copies of a memoized function share the same cache.
+     * The capacity of a bounded cache is approximate: each shard holds up to capacity / Shards results,
+     * rounded up, and evicts its own least recently used result when it is full. The cache as a whole
+     * can therefore hold up to Shards - 1 results more than the capacity.
+     *
+     * @tparam Return   The return type of the function
+     * @tparam Args     The parameters of the function, which must be hashable and equality comparable
+     * @tparam F        The type of the memoized function
+     * @tparam Shards   The number of cache shards, must be a power of 2
+     */
+    template<typename Return, typename... Args, typename F, std::size_t Shards>
+    class memoized<Return(Args ...), F, Shards>
+    {
+        static_assert(Shards > 0 && (Shards & (Shards - 1)) == 0, "the number of shards must be a power of 2");
+        static_assert(!std::is_void_v<Return>, "only functions that return values can be memoized");
+
+    public:
+        using key_type = std::tuple<std::decay_t<Args> ...>;
+        using value_type = std::decay_t<Return>;
+
+    private:
+        struct alignas(detail::cache_line_size) shard
+        {
+            using entry_list = std::list<std::pair<key_type, value_type>>;
+
+            std::mutex mutex;
+            // Most recently used entries come first
+            entry_list entries;
+            std::unordered_map<key_type, typename entry_list::iterator, detail::tuple_hash> index;
+            std::size_t hits = 0;
+            std::size_t misses = 0;
+        };
+
+        struct cache
+        {
+            std::size_t shard_capacity;
+            std::array<shard, Shards> shards;
+
+            explicit cache(std::size_t capacity) : shard_capacity{(capacity + Shards - 1) / Shards} {}
+        };
+
+        FUN_NO_UNIQUE_ADDRESS F _f;
+        std::shared_ptr<cache> _cache;
+
+    public:
+        /**
+         * @param f         The function being memoized
+         * @param capacity  The approximate maximum number of cached results, or 0 for an unbounded cache.
+         *                  Bounded caches evict the least recently used results of each shard.
+         */
+        template<typename G>
+        requires (!std::is_same_v<std::remove_cvref_t<G>, memoized>)
+        explicit memoized(G &&f, std::size_t capacity = 0)
+            : _f(std::forward<G>(f)), _cache{std::make_shared<cache>(capacity)} {}
+
+        value_type operator()(Args... args) const
+        {
+            key_type key{args ...};
+            shard &s = _cache->shards[detail::hash_mix(detail::tuple_hash{}(key)) & (Shards - 1)];
+            std::size_t const capacity = _cache->shard_capacity;
+
+            {
+                std::scoped_lock lock{s.mutex};
+                if (auto it = s.index.find(key); it != s.index.end())
+                {
+                    ++s.hits;
+                    if (capacity)
+                        s.entries.splice(s.entries.begin(), s.entries, it->second);
+                    return it->second->second;
+                }
+                ++s.misses;
+            }
+
+            value_type value = std::invoke(_f, std::forward<Args>(args) ...);
+
+            std::scoped_lock lock{s.mutex};
+            // Another thread may have computed the same result in the meantime
+            if (auto it = s.index.find(key); it != s.index.end())
+                return it->second->second;
+
+            s.entries.emplace_front(std::move(key), value);
+            s.index.emplace(s.entries.front().first, s.entries.begin());
+            if (capacity && s.entries.size() > capacity)
+            {
+                s.index.erase(s.entries.back().first);
+                s.entries.pop_back();
+            }
+            return value;
+        }
+
+        [[nodiscard]] memoize_stats stats() const
+        {
+            memoize_stats result{};
+            for (shard &s : _cache->shards)
+            {
+                std::scoped_lock lock{s.mutex};
+                result.hits += s.hits;
+                result.misses += s.misses;
+                result.size += s.entries.size();
+            }
+            return result;
+        }
+
+        void clear()
+        {
+            for (shard &s : _cache->shards)
+            {
+                std::scoped_lock lock{s.mutex};
+                s.index.clear();
+                s.entries.clear();
+            }
+        }
+    };
+
+    /**
+     * Creates a thread-safe memoized version of a pure function with the given call signature.
+     * Useful for generic callables, such as overload sets, which do not have a unique signature.
+     *
+     * @tparam Signature    The call signature used for caching results
+     * @tparam Shards       The number of cache shards, must be a power of 2
+     * @param f             The function being memoized
+     * @param capacity      The approximate maximum number of cached results, or 0 for an unbounded cache
+     * @return              The memoized function
+     */
+    template<typename Signature, std::size_t Shards = memoize_shards, traits::callable F>
+    [[nodiscard]] auto memoize(F &&f, std::size_t capacity = 0)
+    {
+        return memoized<Signature, std::decay_t<F>, Shards>{std::forward<F>(f), capacity};
+    }
+
+    /**
+     * Creates a thread-safe memoized version of a pure function with a single call signature.
+     *
+     * @tparam Shards   The number of cache shards, must be a power of 2
+     * @param f         The function being memoized
+     * @param capacity  The approximate maximum number of cached results, or 0 for an unbounded cache
+     * @return          The memoized function
+     */
+    template<std::size_t Shards = memoize_shards, traits::callable F>
+    [[nodiscard]] auto memoize(F &&f, std::size_t capacity = 0)
+    {
+        return memoize<detail::deduced_signature<std::decay_t<F>>, Shards>(std::forward<F>(f), capacity);
+    }
+}
+#endif //FUN_MEMOIZE_HPP
@@ -1,12 +1,19 @@
 #ifndef FUN_OVERLOAD_HPP
 #define FUN_OVERLOAD_HPP
 
+#include <array>
+#include <cstddef>
+#include <tuple>
 #include <variant>
+#include <fun/dispatch.hpp>
 #include <fun/function.hpp>
 #include <fun/traits.hpp>
 
 namespace fun
 {
+    template<typename... Ts>
+    class variant;
+
     namespace detail
     {
         template<traits::callable F>
@@ -14,7 +21,7 @@ namespace fun
 
         template<traits::callable F>
         requires (!std::is_class_v<F>)
-        struct callable_wrapper_impl<F> : std::type_identity<decltype(function{std::declval<F>()})> {};
+        struct callable_wrapper_impl<F> : std::type_identity<function<typename traits::signature_of<F>::type>> {};
 
         template<traits::callable F>
         using callable_wrapper = typename detail::callable_wrapper_impl<F>::type;
@@ -49,20 +56,186 @@ namespace fun
         return overload_set{std::forward<Fs>(fs) ...};
     }
 
+    namespace detail
+    {
+        // Deduces the variant that a class is or derives from publicly, like std::visit does
+        template<typename... Ts>
+        auto variant_base(std::variant<Ts ...> const *) -> std::variant<Ts ...>;
+
+        template<typename... Ts>
+        auto variant_base(variant<Ts ...> const *) -> variant<Ts ...>;
+
+        template<typename T>
+        struct is_variant_impl : std::false_type {};
+
+        template<typename T>
+        requires requires (T const *v) { variant_base(v); }
+        struct is_variant_impl<T> : std::true_type {};
+
+        template<typename T>
+        inline constexpr bool is_variant_v = is_variant_impl<std::remove_cvref_t<T>>::value;
+
+        template<typename Variant>
+        using variant_base_t = decltype(variant_base(std::declval<std::remove_cvref_t<Variant> const *>()));
+
+        template<typename Variant>
+        inline constexpr std::size_t variant_size_v = std::variant_size_v<variant_base_t<Variant>>;
+
+        // Finds std::get for std::variant and fun::get for fun::variant, which returns packed alternatives by value
+        template<std::size_t I, typename Variant>
+        constexpr decltype(auto) get_alternative(Variant &&v)
+        {
+            using std::get;
+            return get<I>(std::forward<Variant>(v));
+        }
+
+        template<typename... Args>
+        constexpr std::size_t leading_variants() noexcept
+        {
+            constexpr bool flags[] = {is_variant_v<Args> ..., false};
+            std::size_t count = 0;
+            while (flags[count])
+                ++count;
+            return count;
+        }
+
+        template<typename>
+        inline constexpr std::size_t zero = 0;
+
+        template<typename F, typename Indices, typename... Variants>
+        struct match_alternatives;
+
+        template<typename F, std::size_t... Indices, typename... Variants>
+        struct match_alternatives<F, std::index_sequence<Indices ...>, Variants ...>
+        {
+            using result = std::invoke_result_t<F, decltype(get_alternative<Indices>(std::declval<Variants>())) ...>;
+
+            template<typename R>
+            static constexpr R call(F &&f, Variants &&... variants)
+            {
+                static_assert(std::is_same_v<result, R>, "all matchers must return the same type");
+
+                // Lets the optimizer fold away the index checks inside std::get after dispatching
+                ((variants.index() == Indices ? void() : unreachable()), ...);
+                return std::invoke(std::forward<F>(f), get_alternative<Indices>(std::forward<Variants>(variants)) ...);
+            }
+        };
+
+        // Each dimension of the dispatch space has an extra leading entry for the valueless state,
+        // since std::variant_npos wraps around to 0 when incremented
+        template<typename... Variants>
+        inline constexpr std::size_t match_extents[] = {variant_size_v<Variants> + 1 ...};
+
+        template<typename... Variants>
+        inline constexpr auto match_strides = [] {
+            std::array<std::size_t, sizeof... (Variants)> strides{};
+            std::size_t stride = 1;
+            for (std::size_t dim = sizeof... (Variants); dim-- > 0;)
+            {
+                strides[dim] = stride;
+                stride *= match_extents<Variants ...>[dim];
+            }
+            return strides;
+        }();
+
+        template<typename... Variants>
+        inline constexpr std::size_t match_space_size = ((variant_size_v<Variants> + 1) * ... * 1);
+
+        template<std::size_t Flat, std::size_t Dim, typename... Variants>
+        inline constexpr std::size_t match_coordinate =
+            Flat / match_strides<Variants ...>[Dim] % match_extents<Variants ...>[Dim];
+
+        template<typename R, typename F, typename Dims, typename... Variants>
+        struct match_dispatcher_impl;
+
+        template<typename R, typename F, std::size_t... Dims, typename... Variants>
+        struct match_dispatcher_impl<R, F, std::index_sequence<Dims ...>, Variants ...>
+        {
+            static constexpr std::size_t size = match_space_size<Variants ...>;
+
+            template<std::size_t Flat>
+            static constexpr R arm(F &&f, Variants &&... variants)
+            {
+                if constexpr (((match_coordinate<Flat, Dims, Variants ...> == 0) || ...))
+                    throw std::bad_variant_access{};
+                else
+                    return match_alternatives<
+                        F,
+                        std::index_sequence<match_coordinate<Flat, Dims, Variants ...> - 1 ...>,
+                        Variants ...
+                    >::template call<R>(std::forward<F>(f), std::forward<Variants>(variants) ...);
+            }
+
+            static constexpr R dispatch(F &&f, Variants &&... variants)
+            {
+                std::size_t const flat = (((variants.index() + 1) * match_strides<Variants ...>[Dims]) + ... + 0);
+                return visit_index<R, size>(flat, [&]<std::size_t Flat>() -> R {
+                    return arm<Flat>(std::forward<F>(f), std::forward<Variants>(variants) ...);
+                });
+            }
+        };
+
+        /**
+         * Dispatches on the flattened index of any number of variants. Small dispatch spaces use a switch
+         * statement whose arms can be inlined, larger ones use a single table of function pointers.
+         */
+        template<typename R, typename F, typename... Variants>
+        using match_dispatcher = match_dispatcher_impl<R, F, std::index_sequence_for<Variants ...>, Variants ...>;
+
+        template<typename F, typename... Variants>
+        constexpr decltype(auto) match_variants(F &&f, Variants &&... variants)
+        {
+            using result = typename match_alternatives<
+                F,
+                std::index_sequence<zero<Variants> ...>,
+                Variants ...
+            >::result;
+
+            return match_dispatcher<result, F, Variants ...>::dispatch(
+                std::forward<F>(f),
+                std::forward<Variants>(variants) ...
+            );
+        }
+
+        template<typename Args, std::size_t... VariantIndices, std::size_t... MatcherIndices>
+        constexpr decltype(auto) match_split(
+            Args &&args,
+            std::index_sequence<VariantIndices ...>,
+            std::index_sequence<MatcherIndices ...>
+        )
+        {
+            constexpr std::size_t variant_count = sizeof... (VariantIndices);
+            return match_variants(
+                overload(std::get<variant_count + MatcherIndices>(std::move(args)) ...),
+                std::get<VariantIndices>(std::move(args)) ...
+            );
+        }
+    }
+
     /**
-     * Matches a given variant object agains a list of possible function signatures.
-     * The matching functions must all return the same type when invoked with any alternative of the variant.
+     * Matches one or more variant objects agains a list of possible function signatures.
+     * All leading arguments that are variants are matched, the remaining ones are the matching functions.
+     * When matching multiple variants, the functions are invoked with one alternative of each variant.
+     * The matching functions must all return the same type when invoked with any combination of alternatives.
+     * Small variants are dispatched through a switch statement whose arms can be inlined. Larger variants
+     * and combinations of variants are dispatched through a single flattened table of function pointers.
+     * Matching a valueless variant throws std::bad_variant_access.
      *
-     * @tparam Variant  The type of the variant object that will be matched
-     * @tparam Matchers The types of the functions that will be used for matching
-     * @param variant   The variant object beign matched
-     * @param matchers  The functions used to match the object
-     * @return  The result of matching the object agains the functions.
+     * @tparam Args The types of the variant objects, followed by the types of the matching functions
+     * @param args  The variant objects being matched, followed by the functions used to match them
+     * @return  The result of matching the objects agains the functions.
      */
-    template<typename Variant, typename... Matchers>
-    [[nodiscard]] constexpr auto match(Variant &&variant, Matchers &&... matchers) -> decltype(auto)
+    template<typename... Args>
+    [[nodiscard]] constexpr auto match(Args &&... args) -> decltype(auto)
     {
-        return std::visit(overload(std::forward<Matchers>(matchers) ...), std::forward<Variant>(variant));
+        constexpr std::size_t variant_count = detail::leading_variants<Args ...>();
+        static_assert(variant_count > 0, "at least one variant must be matched");
+
+        return detail::match_split(
+            std::forward_as_tuple(std::forward<Args>(args) ...),
+            std::make_index_sequence<variant_count>{},
+            std::make_index_sequence<sizeof... (Args) - variant_count>{}
+        );
     }
 }
 #endif //FUN_OVERLOAD_HPP
\ No newline at end of file
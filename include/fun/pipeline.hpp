@@ -0,0 +1,482 @@
+#ifndef FUN_PIPELINE_HPP
+#define FUN_PIPELINE_HPP
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <ranges>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <fun/traits.hpp>
+
+namespace fun
+{
+    /**
+     * Pipeline stage that replaces each element with the result of a function.
+     */
+    template<typename F>
+    struct map_stage
+    {
+        FUN_NO_UNIQUE_ADDRESS F f;
+
+        template<typename T>
+        using result_type = std::remove_cvref_t<std::invoke_result_t<F const &, T const &>>;
+
+        template<typename T, typename Next>
+        constexpr void push(T &&value, Next &&next) const
+        {
+            next(std::invoke(f, std::forward<T>(value)));
+        }
+
+        template<typename T>
+        constexpr std::size_t push_block(T const *in, std::size_t count, result_type<T> *out) const
+        {
+            for (std::size_t i = 0; i < count; ++i)
+                out[i] = std::invoke(f, in[i]);
+            return count;
+        }
+    };
+
+    /**
+     * Pipeline stage that only keeps the elements which satisfy a predicate.
+     */
+    template<typename P>
+    struct filter_stage
+    {
+        FUN_NO_UNIQUE_ADDRESS P p;
+
+        template<typename T>
+        using result_type = T;
+
+        template<typename T, typename Next>
+        constexpr void push(T &&value, Next &&next) const
+        {
+            if (std::invoke(p, std::as_const(value)))
+                next(std::forward<T>(value));
+        }
+
+        // Every element is copied and only kept if it matches, which avoids branches inside of the loop
+        template<typename T>
+        constexpr std::size_t push_block(T const *in, std::size_t count, T *out) const
+        {
+            std::size_t kept = 0;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                out[kept] = in[i];
+                kept += static_cast<bool>(std::invoke(p, in[i]));
+            }
+            return kept;
+        }
+    };
+
+    /**
+     * Pipeline stage that invokes an action on each element and passes it on unchanged.
+     */
+    template<typename A>
+    struct tap_stage
+    {
+        FUN_NO_UNIQUE_ADDRESS A a;
+
+        template<typename T>
+        using result_type = T;
+
+        template<typename T, typename Next>
+        constexpr void push(T &&value, Next &&next) const
+        {
+            std::invoke(a, std::as_const(value));
+            next(std::forward<T>(value));
+        }
+
+        template<typename T>
+        constexpr std::size_t push_block(T const *in, std::size_t count, T *out) const
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                std::invoke(a, in[i]);
+                out[i] = in[i];
+            }
+            return count;
+        }
+    };
+
+    template<traits::callable F>
+    [[nodiscard]] constexpr map_stage<std::decay_t<F>> map(F &&f)
+    {
+        return {std::forward<F>(f)};
+    }
+
+    template<traits::callable P>
+    [[nodiscard]] constexpr filter_stage<std::decay_t<P>> filter(P &&p)
+    {
+        return {std::forward<P>(p)};
+    }
+
+    template<traits::callable A>
+    [[nodiscard]] constexpr tap_stage<std::decay_t<A>> tap(A &&a)
+    {
+        return {std::forward<A>(a)};
+    }
+
+    // Requests that a pipeline processes its input in blocks of N elements
+    template<std::size_t N>
+    requires (N > 0)
+    struct chunking {};
+
+    template<std::size_t N>
+    inline constexpr chunking<N> chunked{};
+
+    /**
+     * Terminal operation that passes every element to a function.
+     */
+    template<typename F>
+    struct sink_terminal
+    {
+        FUN_NO_UNIQUE_ADDRESS F f;
+
+        template<typename T>
+        constexpr void operator()(T &&value)
+        {
+            std::invoke(f, std::forward<T>(value));
+        }
+
+        constexpr void result() && noexcept {}
+    };
+
+    /**
+     * Terminal operation that combines all elements into a single value, starting from the left.
+     */
+    template<typename T, typename Op>
+    struct fold_terminal
+    {
+        T value;
+        FUN_NO_UNIQUE_ADDRESS Op op;
+
+        template<typename U>
+        constexpr void operator()(U &&element)
+        {
+            value = std::invoke(op, std::move(value), std::forward<U>(element));
+        }
+
+        constexpr T result() &&
+        {
+            return std::move(value);
+        }
+    };
+
+    /**
+     * Terminal operation that writes all elements through an output iterator.
+     */
+    template<typename Out>
+    struct into_terminal
+    {
+        Out out;
+
+        template<typename T>
+        constexpr void operator()(T &&value)
+        {
+            *out = std::forward<T>(value);
+            ++out;
+        }
+
+        constexpr Out result() &&
+        {
+            return std::move(out);
+        }
+    };
+
+    template<traits::callable F>
+    [[nodiscard]] constexpr sink_terminal<std::decay_t<F>> sink(F &&f)
+    {
+        return {std::forward<F>(f)};
+    }
+
+    template<typename T, traits::callable Op>
+    [[nodiscard]] constexpr fold_terminal<std::decay_t<T>, std::decay_t<Op>> fold(T &&init, Op &&op)
+    {
+        return {std::forward<T>(init), std::forward<Op>(op)};
+    }
+
+    template<std::input_or_output_iterator Out>
+    [[nodiscard]] constexpr into_terminal<Out> into(Out out)
+    {
+        return {std::move(out)};
+    }
+
+    template<std::size_t ChunkSize, typename... Stages>
+    class pipeline;
+
+    namespace detail
+    {
+        template<typename>
+        struct pipeline_traits
+        {
+            static constexpr bool is_stage = false;
+            static constexpr bool is_terminal = false;
+        };
+
+        template<typename F>
+        struct pipeline_traits<map_stage<F>> : pipeline_traits<void>
+        {
+            static constexpr bool is_stage = true;
+        };
+
+        template<typename P>
+        struct pipeline_traits<filter_stage<P>> : pipeline_traits<void>
+        {
+            static constexpr bool is_stage = true;
+        };
+
+        template<typename A>
+        struct pipeline_traits<tap_stage<A>> : pipeline_traits<void>
+        {
+            static constexpr bool is_stage = true;
+        };
+
+        template<typename F>
+        struct pipeline_traits<sink_terminal<F>> : pipeline_traits<void>
+        {
+            static constexpr bool is_terminal = true;
+        };
+
+        template<typename T, typename Op>
+        struct pipeline_traits<fold_terminal<T, Op>> : pipeline_traits<void>
+        {
+            static constexpr bool is_terminal = true;
+        };
+
+        template<typename Out>
+        struct pipeline_traits<into_terminal<Out>> : pipeline_traits<void>
+        {
+            static constexpr bool is_terminal = true;
+        };
+
+        template<typename T>
+        concept pipeline_stage = pipeline_traits<std::remove_cvref_t<T>>::is_stage;
+
+        template<typename T>
+        concept pipeline_terminal = pipeline_traits<std::remove_cvref_t<T>>::is_terminal;
+
+        template<typename>
+        struct is_pipeline : std::false_type {};
+
+        template<std::size_t ChunkSize, typename... Stages>
+        struct is_pipeline<pipeline<ChunkSize, Stages ...>> : std::true_type {};
+
+        template<typename>
+        struct is_chunking : std::false_type {};
+
+        template<std::size_t N>
+        struct is_chunking<chunking<N>> : std::true_type {};
+
+        // Anything that can be turned into a pipeline and composed with others
+        template<typename T>
+        concept pipeline_like = pipeline_stage<T> || is_pipeline<std::remove_cvref_t<T>>::value
+            || is_chunking<std::remove_cvref_t<T>>::value;
+
+        template<pipeline_like T>
+        constexpr auto as_pipeline(T &&t)
+        {
+            using type = std::remove_cvref_t<T>;
+            if constexpr (is_pipeline<type>::value)
+                return std::forward<T>(t);
+            else if constexpr (pipeline_stage<type>)
+                return pipeline<0, type>{std::forward<T>(t)};
+            else
+                return []<std::size_t N>(chunking<N>) { return pipeline<N>{}; }(t);
+        }
+    }
+
+    /**
+     * A sequence of stages fused into a single loop over a range, without any intermediate containers.
+     * Every element is pushed through all stages before the next one is read, so that the stages can be
+     * inlined into each other. With a chunk size, the input is instead processed in blocks and each stage
+     * runs as a separate loop over a local buffer, which gives the vectorizer simple loops over contiguous data.
+     *
+     * @tparam ChunkSize    The number of elements in each block, or 0 to process elements one at a time
+     * @tparam Stages       The types of the stages
+     */
+    template<std::size_t ChunkSize, typename... Stages>
+    class pipeline
+    {
+        FUN_NO_UNIQUE_ADDRESS std::tuple<Stages ...> _stages;
+
+        template<std::size_t I, typename T, typename Consumer>
+        constexpr void push(T &&value, Consumer &consumer) const
+        {
+            if constexpr (I == sizeof... (Stages))
+            {
+                consumer(std::forward<T>(value));
+            }
+            else
+            {
+                std::get<I>(_stages).push(std::forward<T>(value), [&](auto &&next) {
+                    push<I + 1>(std::forward<decltype(next)>(next), consumer);
+                });
+            }
+        }
+
+        template<std::size_t I, typename T, typename Consumer>
+        constexpr void push_block(T const *in, std::size_t count, Consumer &consumer) const
+        {
+            if constexpr (I == sizeof... (Stages))
+            {
+                for (std::size_t i = 0; i < count; ++i)
+                    consumer(in[i]);
+            }
+            else
+            {
+                using stage = std::tuple_element_t<I, std::tuple<Stages ...>>;
+                using result = typename stage::template result_type<T>;
+                static_assert(std::is_default_constructible_v<result>, "chunked pipelines need default constructible elements");
+
+                std::array<result, ChunkSize> out;
+                std::size_t const produced = std::get<I>(_stages).push_block(in, count, out.data());
+                push_block<I + 1>(static_cast<result const *>(out.data()), produced, consumer);
+            }
+        }
+
+        template<typename R, typename Consumer>
+        constexpr void run_chunked(R &&range, Consumer &consumer) const
+        {
+            if constexpr (std::ranges::contiguous_range<R> && std::ranges::sized_range<R>)
+            {
+                auto const *const data = std::ranges::data(range);
+                std::size_t const size = std::ranges::size(range);
+                for (std::size_t i = 0; i < size; i += ChunkSize)
+                    push_block<0>(data + i, size - i < ChunkSize ? size - i : ChunkSize, consumer);
+            }
+            else
+            {
+                // Other ranges are gathered into a buffer first
+                using value_type = std::ranges::range_value_t<R>;
+                std::array<value_type, ChunkSize> buffer;
+                std::size_t count = 0;
+                for (auto &&value : range)
+                {
+                    buffer[count++] = std::forward<decltype(value)>(value);
+                    if (count == ChunkSize)
+                    {
+                        push_block<0>(static_cast<value_type const *>(buffer.data()), count, consumer);
+                        count = 0;
+                    }
+                }
+                push_block<0>(static_cast<value_type const *>(buffer.data()), count, consumer);
+            }
+        }
+
+    public:
+        static constexpr std::size_t chunk_size = ChunkSize;
+
+        constexpr pipeline() = default;
+
+        template<typename... Ts>
+        requires (sizeof... (Ts) == sizeof... (Stages) && sizeof... (Ts) > 0)
+        constexpr explicit pipeline(Ts &&... stages) : _stages{std::forward<Ts>(stages) ...} {}
+
+        [[nodiscard]] constexpr std::tuple<Stages ...> const &stages() const & noexcept
+        {
+            return _stages;
+        }
+
+        [[nodiscard]] constexpr std::tuple<Stages ...> &&stages() && noexcept
+        {
+            return std::move(_stages);
+        }
+
+        /**
+         * Pushes all elements of a range through the stages and into a terminal operation.
+         *
+         * @param range     The input range
+         * @param terminal  The terminal operation that consumes the results
+         * @return          The result of the terminal operation
+         */
+        template<std::ranges::input_range R, detail::pipeline_terminal Terminal>
+        constexpr decltype(auto) run(R &&range, Terminal terminal) const
+        {
+            if constexpr (ChunkSize == 0)
+            {
+                for (auto &&value : range)
+                    push<0>(std::forward<decltype(value)>(value), terminal);
+            }
+            else
+            {
+                run_chunked(range, terminal);
+            }
+            return std::move(terminal).result();
+        }
+    };
+
+    template<typename... Stages>
+    pipeline(Stages ...) -> pipeline<0, Stages ...>;
+
+    /**
+     * A range bound to a pipeline, waiting for more stages or a terminal operation.
+     */
+    template<std::ranges::view V, typename Pipeline>
+    class bound_pipeline
+    {
+        V _range;
+        Pipeline _pipeline;
+
+    public:
+        constexpr bound_pipeline(V range, Pipeline pipeline) : _range{std::move(range)}, _pipeline{std::move(pipeline)} {}
+
+        template<detail::pipeline_like P>
+        [[nodiscard]] friend constexpr auto operator|(bound_pipeline bound, P &&p)
+        {
+            auto extended = std::move(bound._pipeline) | std::forward<P>(p);
+            return bound_pipeline<V, decltype(extended)>{std::move(bound._range), std::move(extended)};
+        }
+
+        template<detail::pipeline_terminal Terminal>
+        friend constexpr decltype(auto) operator|(bound_pipeline bound, Terminal &&terminal)
+        {
+            return bound._pipeline.run(bound._range, std::forward<Terminal>(terminal));
+        }
+    };
+
+    /**
+     * Composes stages and pipelines into a single pipeline, keeping the largest chunk size.
+     */
+    template<detail::pipeline_like A, detail::pipeline_like B>
+    [[nodiscard]] constexpr auto operator|(A &&a, B &&b)
+    {
+        auto lhs = detail::as_pipeline(std::forward<A>(a));
+        auto rhs = detail::as_pipeline(std::forward<B>(b));
+        constexpr std::size_t chunk_size = decltype(lhs)::chunk_size > decltype(rhs)::chunk_size
+            ? decltype(lhs)::chunk_size
+            : decltype(rhs)::chunk_size;
+
+        return std::apply([]<typename... Stages>(Stages &&... stages) {
+            if constexpr (sizeof... (Stages) == 0)
+                return pipeline<chunk_size>{};
+            else
+                return pipeline<chunk_size, std::remove_cvref_t<Stages> ...>{std::forward<Stages>(stages) ...};
+        }, std::tuple_cat(std::move(lhs).stages(), std::move(rhs).stages()));
+    }
+
+    template<std::ranges::viewable_range R, detail::pipeline_like P>
+    requires (!detail::pipeline_like<R>)
+    [[nodiscard]] constexpr auto operator|(R &&range, P &&p)
+    {
+        auto composed = detail::as_pipeline(std::forward<P>(p));
+        return bound_pipeline<std::views::all_t<R>, decltype(composed)>{
+            std::views::all(std::forward<R>(range)),
+            std::move(composed)
+        };
+    }
+
+    /**
+     * Composes a list of stages into a pipeline, which can later be bound to ranges with operator|.
+     *
+     * @param stages    The stages, pipelines and chunk sizes, in order of application
+     * @return          The fused pipeline
+     */
+    template<detail::pipeline_like... Ps>
+    [[nodiscard]] constexpr auto compose(Ps &&... ps)
+    {
+        return (pipeline<0>{} | ... | std::forward<Ps>(ps));
+    }
+}
+#endif //FUN_PIPELINE_HPP
@@ -0,0 +1,179 @@
+#ifndef FUN_POLY_VECTOR_HPP
+#define FUN_POLY_VECTOR_HPP
+
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <fun/overload.hpp>
+
+namespace fun
+{
+    /**
+     * A heterogeneous sequence container that stores the elements of each type in their own contiguous segment.
+     * Elements take only the space of their own type, and are visited with one loop per type, which needs
+     * no dispatch and can be vectorized. The order of elements is kept within each type, but not across types.
+     * Segments of bools hold fun::boolean elements, so that they can be viewed as spans.
+     *
+     * @tparam Ts   The types of the stored elements, which must be distinct
+     */
+    template<typename T, typename... Ts>
+    requires (!std::is_reference_v<T>) && (!std::is_reference_v<Ts> && ...)
+    class poly_vector
+    {
+        using segments_type = std::tuple<
+            std::vector<detail::element_storage_t<T>>,
+            std::vector<detail::element_storage_t<Ts>> ...
+        >;
+
+        static constexpr std::size_t type_count = sizeof... (Ts) + 1;
+
+        // Position of a type in the list of stored types, or type_count if it is not stored
+        template<typename U>
+        static constexpr std::size_t type_index = [] {
+            constexpr bool flags[] = {std::is_same_v<U, T>, std::is_same_v<U, Ts> ...};
+            std::size_t index = 0;
+            while (index < type_count && !flags[index])
+                ++index;
+            return index;
+        }();
+
+        // Each type is found at its own position only if it does not appear earlier in the list
+        static_assert([] {
+            constexpr std::size_t indices[] = {type_index<T>, type_index<Ts> ...};
+            for (std::size_t i = 0; i < type_count; ++i)
+                if (indices[i] != i)
+                    return false;
+            return true;
+        }(), "the stored types must be distinct");
+
+        segments_type _segments;
+
+        template<typename Self, typename F, std::size_t... Indices>
+        static constexpr void for_each_impl(Self &self, F &&f, std::index_sequence<Indices ...>)
+        {
+            auto const visit_segment = [&](auto &segment) {
+                for (auto &element : segment)
+                    std::invoke(f, detail::stored_value(element));
+            };
+            (visit_segment(std::get<Indices>(self._segments)), ...);
+        }
+
+    public:
+        template<typename U>
+        static constexpr bool holds = type_index<U> < type_count;
+
+        using size_type = std::size_t;
+
+        /**
+         * Total number of elements of all types.
+         */
+        [[nodiscard]] constexpr size_type size() const noexcept
+        {
+            return std::apply([](auto const &... segments) { return (segments.size() + ...); }, _segments);
+        }
+
+        /**
+         * Number of elements of a single type.
+         */
+        template<typename U>
+        requires holds<U>
+        [[nodiscard]] constexpr size_type size() const noexcept
+        {
+            return std::get<type_index<U>>(_segments).size();
+        }
+
+        [[nodiscard]] constexpr bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+        template<typename U>
+        requires holds<U>
+        constexpr void reserve(size_type capacity)
+        {
+            std::get<type_index<U>>(_segments).reserve(capacity);
+        }
+
+        constexpr void clear() noexcept
+        {
+            std::apply([](auto &... segments) { (segments.clear(), ...); }, _segments);
+        }
+
+        /**
+         * Appends an element to the segment of its type.
+         */
+        template<typename U>
+        requires holds<std::remove_cvref_t<U>>
+        constexpr void push_back(U &&value)
+        {
+            std::get<type_index<std::remove_cvref_t<U>>>(_segments).push_back(std::forward<U>(value));
+        }
+
+        template<typename U, typename... Args>
+        requires holds<U> && std::is_constructible_v<U, Args ...>
+        constexpr U &emplace_back(Args &&... args)
+        {
+            return detail::stored_value(std::get<type_index<U>>(_segments).emplace_back(std::forward<Args>(args) ...));
+        }
+
+        /**
+         * Removes an element from the segment of its type, shifting all following elements of that type.
+         *
+         * @tparam U    The type of the removed element
+         * @param index The position of the element inside of its segment
+         */
+        template<typename U>
+        requires holds<U>
+        constexpr void erase(size_type index)
+        {
+            auto &segment = std::get<type_index<U>>(_segments);
+            if (index >= segment.size())
+                throw std::out_of_range{"poly_vector index out of range"};
+            segment.erase(segment.begin() + static_cast<std::ptrdiff_t>(index));
+        }
+
+        template<typename U>
+        requires holds<U>
+        [[nodiscard]] constexpr std::span<detail::element_storage_t<U>> segment() noexcept
+        {
+            return std::get<type_index<U>>(_segments);
+        }
+
+        template<typename U>
+        requires holds<U>
+        [[nodiscard]] constexpr std::span<detail::element_storage_t<U> const> segment() const noexcept
+        {
+            return std::get<type_index<U>>(_segments);
+        }
+
+        /**
+         * Invokes an overload set of the given functions on every element, one segment at a time, in the order
+         * of the stored types. The functions must accept all stored types, as they would for fun::match.
+         *
+         * @param fs    The functions that make up the overload set
+         */
+        template<traits::callable... Fs>
+        requires (sizeof... (Fs) > 0)
+              && std::is_invocable_v<decltype(overload(std::declval<Fs>() ...)) &, T &>
+              && (std::is_invocable_v<decltype(overload(std::declval<Fs>() ...)) &, Ts &> && ...)
+        constexpr void for_each(Fs &&... fs)
+        {
+            for_each_impl(*this, overload(std::forward<Fs>(fs) ...), std::make_index_sequence<type_count>{});
+        }
+
+        template<traits::callable... Fs>
+        requires (sizeof... (Fs) > 0)
+              && std::is_invocable_v<decltype(overload(std::declval<Fs>() ...)) &, T const &>
+              && (std::is_invocable_v<decltype(overload(std::declval<Fs>() ...)) &, Ts const &> && ...)
+        constexpr void for_each(Fs &&... fs) const
+        {
+            for_each_impl(*this, overload(std::forward<Fs>(fs) ...), std::make_index_sequence<type_count>{});
+        }
+    };
+}
+#endif //FUN_POLY_VECTOR_HPP
@@ -0,0 +1,376 @@
+#ifndef FUN_REFLECT_HPP
+#define FUN_REFLECT_HPP
+
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <fun/utility.hpp>
+
+namespace fun
+{
+    // Largest number of fields supported by aggregate reflection
+    inline constexpr std::size_t max_reflected_fields = 32;
+
+    namespace detail
+    {
+        template<typename T, std::size_t... Indices>
+        constexpr bool is_brace_constructible(std::index_sequence<Indices ...>) noexcept
+        {
+            return requires { T{rvalue<Indices>() ...}; };
+        }
+
+        // fun::any converts to every member type, which also prevents brace elision for nested aggregates
+        template<typename T>
+        constexpr std::size_t count_fields() noexcept
+        {
+            std::size_t count = 0;
+            [&]<std::size_t... Counts>(std::index_sequence<Counts ...>) {
+                ((is_brace_constructible<T>(std::make_index_sequence<Counts + 1>{}) ? void(count = Counts + 1) : void()), ...);
+            }(std::make_index_sequence<max_reflected_fields + 1>{});
+            return count;
+        }
+
+        // A braced initializer takes a whole array member at once, leaving too few fields for the other placeholders
+        template<typename T, std::size_t... Before, std::size_t... After>
+        constexpr bool is_braced_field(std::index_sequence<Before ...>, std::index_sequence<After ...>) noexcept
+        {
+            return requires { T{rvalue<Before>() ..., {}, rvalue<After>() ...}; }
+                || requires { T{rvalue<Before>() ..., {rvalue<>()}, rvalue<After>() ...}; };
+        }
+
+        // Arrays are brace-elided when counting fields, so each of their elements is counted as a field
+        template<typename T>
+        constexpr bool has_array_fields() noexcept
+        {
+            constexpr std::size_t count = count_fields<T>();
+            return [&]<std::size_t... Indices>(std::index_sequence<Indices ...>) {
+                return !(is_braced_field<T>(std::make_index_sequence<Indices>{}, std::make_index_sequence<count - Indices - 1>{}) && ...);
+            }(std::make_index_sequence<count>{});
+        }
+    }
+
+    template<typename T>
+    concept reflectable = std::is_aggregate_v<T> && !std::is_array_v<T>
+        && detail::count_fields<T>() <= max_reflected_fields && !detail::has_array_fields<T>();
+
+    /**
+     * The number of fields of an aggregate, detected by brace-initializing it with placeholders.
+     * Aggregates with array fields are not reflectable, since their elements would be counted instead.
+     *
+     * @tparam T    The aggregate type
+     */
+    template<reflectable T>
+    inline constexpr std::size_t field_count = detail::count_fields<T>();
+
+    /**
+     * Binds the fields of an aggregate to a tuple of references, using structured bindings.
+     *
+     * @param obj   The aggregate object
+     * @return      A tuple with one reference to each field
+     */
+    template<typename T>
+    requires reflectable<std::remove_const_t<T>>
+    [[nodiscard]] constexpr auto tie_fields(T &obj) noexcept
+    {
+        constexpr std::size_t count = field_count<std::remove_const_t<T>>;
+        if constexpr (count == 0)
+        {
+            return std::tie();
+        }
+        else if constexpr (count == 1)
+        {
+            auto &[f0] = obj;
+            return std::tie(f0);
+        }
+        else if constexpr (count == 2)
+        {
+            auto &[f0, f1] = obj;
+            return std::tie(f0, f1);
+        }
+        else if constexpr (count == 3)
+        {
+            auto &[f0, f1, f2] = obj;
+            return std::tie(f0, f1, f2);
+        }
+        else if constexpr (count == 4)
+        {
+            auto &[f0, f1, f2, f3] = obj;
+            return std::tie(f0, f1, f2, f3);
+        }
+        else if constexpr (count == 5)
+        {
+            auto &[f0, f1, f2, f3, f4] = obj;
+            return std::tie(f0, f1, f2, f3, f4);
+        }
+        else if constexpr (count == 6)
+        {
+            auto &[f0, f1, f2, f3, f4, f5] = obj;
+            return std::tie(f0, f1, f2, f3, f4, f5);
+        }
+        else if constexpr (count == 7)
+        {
+            auto &[f0, f1, f2, f3, f4, f5, f6] = obj;
+            return std::tie(f0, f1, f2, f3, f4, f5, f6);
+        }
+        else if constexpr (count == 8)
+        {
+            auto &[f0, f1, f2, f3, f4, f5, f6, f7] = obj;
+            return std::tie(f0, f1, f2, f3, f4, f5, f6, f7);
+        }
+        else if constexpr (count == 9)
+        {
+            auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8] = obj;
+            return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8);
+        }
+        else if constexpr (count == 10)
+        {
+            auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9] = obj;
+            return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9);
+        }
+        else if constexpr (count == 11)
+        {
+            auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10] = obj;
+            return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10);
+        }
+        else if constexpr (count == 12)
+        {
+            auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11] = obj;
+            return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11);
+        }
+        else if constexpr (count == 13)
+        {
+            auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12] = obj;
+            return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12);
+        }
+        else if constexpr (count == 14)
+        {
+            auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13] = obj;
+            return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13);
+        }
+        else if constexpr (count == 15)
+        {
+            auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14] = obj;
+            return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14);
+        }
+        else if constexpr (count == 16)
+        {
+            auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15] = obj;
+            return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15);
+        }
+        else if constexpr (count == 17)
+        {
+            auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16] = obj;
+            return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16);
+        }
+        else if constexpr (count == 18)
+        {
+            auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17] = obj;
+            return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17);
+        }
+        else if constexpr (count == 19)
+        {
+            auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18] = obj;
+            return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18);
+        }
+        else if constexpr (count == 20)
+        {
+            auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19] = obj;
+            return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19);
+        }
+        else if constexpr (count == 21)
+        {
+            auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20] = obj;
+            return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20);
+        }
+        else if constexpr (count == 22)
+        {
+            auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21] = obj;
+            return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21);
+        }
+        else if constexpr (count == 23)
+        {
+            auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22] = obj;
+            return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22);
+        }
+        else if constexpr (count == 24)
+        {
+            auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23] = obj;
+            return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23);
+        }
+        else if constexpr (count == 25)
+        {
+            auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24] = obj;
+            return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24);
+        }
+        else if constexpr (count == 26)
+        {
+            auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25] = obj;
+            return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25);
+        }
+        else if constexpr (count == 27)
+        {
+            auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26] = obj;
+            return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26);
+        }
+        else if constexpr (count == 28)
+        {
+            auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27] = obj;
+            return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27);
+        }
+        else if constexpr (count == 29)
+        {
+            auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28] = obj;
+            return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28);
+        }
+        else if constexpr (count == 30)
+        {
+            auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29] = obj;
+            return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29);
+        }
+        else if constexpr (count == 31)
+        {
+            auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30] = obj;
+            return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30);
+        }
+        else if constexpr (count == 32)
+        {
+            auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31] = obj;
+            return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31);
+        }
+    }
+
+    /**
+     * Compares aggregates field by field. Fields that are aggregates without operator== are compared
+     * recursively. Types with unique object representations are compared with a single memcmp
+     * outside of constant evaluation.
+     */
+    struct fields_equal_to
+    {
+        template<reflectable T>
+        [[nodiscard]] constexpr bool operator()(T const &lhs, T const &rhs) const
+        {
+            if constexpr (std::has_unique_object_representations_v<T>)
+                if (!std::is_constant_evaluated())
+                    return std::memcmp(std::addressof(lhs), std::addressof(rhs), sizeof(T)) == 0;
+
+            return [&]<std::size_t... Indices>(std::index_sequence<Indices ...>) {
+                auto const l = tie_fields(lhs);
+                auto const r = tie_fields(rhs);
+                return (equal_field(std::get<Indices>(l), std::get<Indices>(r)) && ...);
+            }(std::make_index_sequence<field_count<T>>{});
+        }
+
+    private:
+        template<typename F>
+        static constexpr bool equal_field(F const &lhs, F const &rhs)
+        {
+            if constexpr (std::equality_comparable<F>)
+                return lhs == rhs;
+            else
+                return fields_equal_to{}(lhs, rhs);
+        }
+    };
+
+    /**
+     * Orders aggregates lexicographically by their fields, in declaration order. Fields that are
+     * aggregates without operator<=> are ordered recursively. There is no memcmp fast path,
+     * since the order of bytes does not match the order of multi-byte integers.
+     */
+    struct fields_compare_three_way
+    {
+        template<reflectable T>
+        [[nodiscard]] constexpr auto operator()(T const &lhs, T const &rhs) const
+        {
+            return [&]<std::size_t... Indices>(std::index_sequence<Indices ...>) {
+                auto const l = tie_fields(lhs);
+                auto const r = tie_fields(rhs);
+                using ordering = std::common_comparison_category_t<
+                    decltype(compare_field(std::get<Indices>(l), std::get<Indices>(r))) ...
+                >;
+                ordering result = std::strong_ordering::equal;
+                static_cast<void>((((result = compare_field(std::get<Indices>(l), std::get<Indices>(r))) == 0) && ...));
+                return result;
+            }(std::make_index_sequence<field_count<T>>{});
+        }
+
+    private:
+        template<typename F>
+        static constexpr auto compare_field(F const &lhs, F const &rhs)
+        {
+            if constexpr (std::three_way_comparable<F>)
+                return lhs <=> rhs;
+            else
+                return fields_compare_three_way{}(lhs, rhs);
+        }
+    };
+
+    struct fields_less
+    {
+        template<reflectable T>
+        [[nodiscard]] constexpr bool operator()(T const &lhs, T const &rhs) const
+        {
+            return fields_compare_three_way{}(lhs, rhs) < 0;
+        }
+    };
+
+    /**
+     * Hashes aggregates by combining the hashes of their fields. Fields that are aggregates without
+     * a std::hash specialization are hashed recursively. Types with unique object representations
+     * are hashed one word at a time, without looking at their fields.
+     */
+    struct fields_hash
+    {
+        template<reflectable T>
+        [[nodiscard]] std::size_t operator()(T const &obj) const noexcept
+        {
+            if constexpr (std::has_unique_object_representations_v<T>)
+            {
+                auto const *bytes = reinterpret_cast<unsigned char const *>(std::addressof(obj));
+                std::size_t seed = sizeof(T);
+                std::size_t offset = 0;
+                for (; offset + sizeof(std::uint64_t) <= sizeof(T); offset += sizeof(std::uint64_t))
+                {
+                    std::uint64_t word;
+                    std::memcpy(&word, bytes + offset, sizeof(word));
+                    seed = detail::hash_combine(seed, static_cast<std::size_t>(word));
+                }
+                if (offset < sizeof(T))
+                {
+                    std::uint64_t word = 0;
+                    std::memcpy(&word, bytes + offset, sizeof(T) - offset);
+                    seed = detail::hash_combine(seed, static_cast<std::size_t>(word));
+                }
+                return detail::hash_mix(seed);
+            }
+            else
+            {
+                return std::apply(
+                    [](auto const &... fields) {
+                        std::size_t seed = 0;
+                        ((seed = detail::hash_combine(seed, hash_field(fields))), ...);
+                        return seed;
+                    },
+                    tie_fields(obj)
+                );
+            }
+        }
+
+    private:
+        template<typename F>
+        static std::size_t hash_field(F const &field) noexcept
+        {
+            if constexpr (requires { std::hash<F>{}(field); })
+                return std::hash<F>{}(field);
+            else
+                return fields_hash{}(field);
+        }
+    };
+}
+#endif //FUN_REFLECT_HPP
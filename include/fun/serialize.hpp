@@ -0,0 +1,237 @@
+#ifndef FUN_SERIALIZE_HPP
+#define FUN_SERIALIZE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <fun/member_pointer.hpp>
+
+namespace fun
+{
+    namespace detail
+    {
+        // Members that are not trivially copyable are written as a length followed by their elements
+        template<typename T>
+        concept serializable_range = !std::is_trivially_copyable_v<T> && std::ranges::contiguous_range<T>
+            && std::ranges::sized_range<T> && std::is_trivially_copyable_v<std::ranges::range_value_t<T>>
+            && requires (T &t, std::size_t n) { t.resize(n); };
+
+        template<typename T>
+        concept serializable_member = std::is_trivially_copyable_v<T> || serializable_range<T>;
+
+        using serialized_length = std::uint64_t;
+
+        /**
+         * Accumulates adjacent memory regions, so that consecutive members without padding
+         * between them are copied with a single memcpy. The addresses of members are constant offsets
+         * from the object, which lets the optimizer fold the adjacency checks away.
+         */
+        template<typename Byte>
+        struct copy_run
+        {
+            Byte *start = nullptr;
+            std::size_t size = 0;
+
+            template<typename Flush>
+            constexpr void append(Byte *region, std::size_t region_size, Flush &&flush)
+            {
+                if (start + size != region)
+                {
+                    flush(start, size);
+                    start = region;
+                    size = 0;
+                }
+                size += region_size;
+            }
+        };
+    }
+
+    /**
+     * Binary serializer for a list of data members of a class.
+     * Trivially copyable members are written in their native representation, without padding, while
+     * contiguous ranges of trivially copyable elements (such as std::string) are prefixed by their length.
+     * Runs of trivially copyable members that are adjacent in memory are merged into single copies.
+     * Buffers are supplied by the caller and nothing is allocated, except when resizing ranges while reading.
+     *
+     * @tparam Ptrs The pointers to the serialized data members, which must all belong to the same class
+     */
+    template<auto Ptr, auto... Ptrs>
+    requires std::is_member_object_pointer_v<decltype(Ptr)> && (std::is_member_object_pointer_v<decltype(Ptrs)> && ...)
+          && (std::is_same_v<detail::member_class_t<Ptr>, detail::member_class_t<Ptrs>> && ...)
+          && detail::serializable_member<detail::member_type_t<Ptr>>
+          && (detail::serializable_member<detail::member_type_t<Ptrs>> && ...)
+    struct serializer
+    {
+        using value_type = detail::member_class_t<Ptr>;
+
+        // Whether all members are trivially copyable, in which case every object takes the same number of bytes
+        static constexpr bool is_fixed_size = std::is_trivially_copyable_v<detail::member_type_t<Ptr>>
+            && (std::is_trivially_copyable_v<detail::member_type_t<Ptrs>> && ...);
+
+        /**
+         * Computes the number of bytes needed to serialize an object.
+         */
+        [[nodiscard]] static constexpr std::size_t size(value_type const &obj) noexcept
+        {
+            return member_size(obj.*Ptr) + (member_size(obj.*Ptrs) + ... + 0);
+        }
+
+        /**
+         * Writes an object into a buffer.
+         *
+         * @param obj   The serialized object
+         * @param out   The buffer, which must be large enough to hold the object
+         * @return      The number of bytes written
+         */
+        static std::size_t serialize(value_type const &obj, std::span<std::byte> out)
+        {
+            if (out.size() < size(obj))
+                throw std::out_of_range{"serialization buffer too small"};
+
+            std::byte *dst = out.data();
+            auto const flush = [&](std::byte const *start, std::size_t count) {
+                if (count > 0)
+                    std::memcpy(dst, start, count);
+                dst += count;
+            };
+
+            detail::copy_run<std::byte const> run{};
+            auto const write = [&](auto const &member) {
+                using member_type = std::remove_cvref_t<decltype(member)>;
+                if constexpr (std::is_trivially_copyable_v<member_type>)
+                {
+                    run.append(reinterpret_cast<std::byte const *>(std::addressof(member)), sizeof(member_type), flush);
+                }
+                else
+                {
+                    run.append(nullptr, 0, flush);
+                    auto const length = static_cast<detail::serialized_length>(std::ranges::size(member));
+                    flush(reinterpret_cast<std::byte const *>(&length), sizeof(length));
+                    flush(
+                        reinterpret_cast<std::byte const *>(std::ranges::data(member)),
+                        length * sizeof(std::ranges::range_value_t<member_type>)
+                    );
+                }
+            };
+
+            write(obj.*Ptr);
+            (write(obj.*Ptrs), ...);
+            flush(run.start, run.size);
+            return static_cast<std::size_t>(dst - out.data());
+        }
+
+        /**
+         * Reads an object from a buffer. Members that are not listed are left unchanged.
+         *
+         * @param in    The buffer, which must begin with a serialized object
+         * @param obj   The object that receives the values
+         * @return      The number of bytes read
+         */
+        static std::size_t deserialize(std::span<std::byte const> in, value_type &obj)
+        {
+            std::byte const *src = in.data();
+            std::byte const *const end = src + in.size();
+            auto const require = [&](std::size_t count) {
+                if (static_cast<std::size_t>(end - src) < count)
+                    throw std::out_of_range{"serialized object truncated"};
+            };
+
+            if constexpr (is_fixed_size)
+                require(size(obj));
+
+            auto const flush = [&](std::byte *start, std::size_t count) {
+                if constexpr (!is_fixed_size)
+                    require(count);
+                if (count > 0)
+                    std::memcpy(start, src, count);
+                src += count;
+            };
+
+            detail::copy_run<std::byte> run{};
+            auto const read = [&](auto &member) {
+                using member_type = std::remove_cvref_t<decltype(member)>;
+                if constexpr (std::is_trivially_copyable_v<member_type>)
+                {
+                    run.append(reinterpret_cast<std::byte *>(std::addressof(member)), sizeof(member_type), flush);
+                }
+                else
+                {
+                    run.append(nullptr, 0, flush);
+                    detail::serialized_length length = 0;
+                    flush(reinterpret_cast<std::byte *>(&length), sizeof(length));
+
+                    using element_type = std::ranges::range_value_t<member_type>;
+                    if (length > static_cast<std::size_t>(end - src) / sizeof(element_type))
+                        throw std::out_of_range{"serialized object truncated"};
+                    member.resize(static_cast<std::size_t>(length));
+                    flush(reinterpret_cast<std::byte *>(std::ranges::data(member)), length * sizeof(element_type));
+                }
+            };
+
+            read(obj.*Ptr);
+            (read(obj.*Ptrs), ...);
+            flush(run.start, run.size);
+            return static_cast<std::size_t>(src - in.data());
+        }
+
+    private:
+        template<typename M>
+        static constexpr std::size_t member_size(M const &member) noexcept
+        {
+            if constexpr (std::is_trivially_copyable_v<M>)
+                return sizeof(M);
+            else
+                return sizeof(detail::serialized_length) + std::ranges::size(member) * sizeof(std::ranges::range_value_t<M>);
+        }
+    };
+
+    // Key of the friend function that exposes the serializer of a class, defined by serializable
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wnon-template-friend"
+#endif
+    template<typename C>
+    struct serializer_key
+    {
+        friend constexpr auto serializer_of_impl(serializer_key);
+    };
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+    template<typename Pointers>
+    struct serializable;
+
+    /**
+     * Makes the class of a sequence of member pointers serializable through serializer_of, which only
+     * needs the name of the class afterwards. An explicit instantiation can also refer to private members.
+     * Each class can have a single serializer.
+     *
+     * @tparam Ptrs The pointers to the serialized data members
+     */
+    template<auto... Ptrs>
+    struct serializable<member_pointers<Ptrs ...>>
+    {
+        using serializer_type = serializer<Ptrs ...>;
+
+        friend constexpr auto serializer_of_impl(serializer_key<typename serializer_type::value_type>)
+        {
+            return serializer_type{};
+        }
+    };
+
+    /**
+     * The serializer of a class that was made serializable with an explicit instantiation
+     * of serializable<member_pointers<Ptrs...>>, which can also refer to private members.
+     *
+     * @tparam C    The serializable class
+     */
+    template<typename C>
+    using serializer_of = decltype(serializer_of_impl(serializer_key<C>{}));
+}
+#endif //FUN_SERIALIZE_HPP
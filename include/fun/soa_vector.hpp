@@ -0,0 +1,228 @@
+#ifndef FUN_SOA_VECTOR_HPP
+#define FUN_SOA_VECTOR_HPP
+
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <fun/member_pointer.hpp>
+
+namespace fun
+{
+    namespace detail
+    {
+        template<auto A, auto B>
+        constexpr bool same_member() noexcept
+        {
+            if constexpr (std::is_same_v<decltype(A), decltype(B)>)
+                return A == B;
+            else
+                return false;
+        }
+    }
+
+    /**
+     * A sequence container that stores each listed data member of a class in its own contiguous column.
+     * Loops that only touch a few members read only their columns, which are also exposed as spans.
+     * Rows are accessed through proxies that refer to one element of each column.
+     * Columns of bool members hold fun::boolean elements, so that they can be viewed as spans.
+     *
+     * @tparam Ptrs The pointers to the stored data members, which must all belong to the same class
+     */
+    template<member_pointer auto Ptr, member_pointer auto... Ptrs>
+    requires std::is_member_object_pointer_v<decltype(Ptr)> && (std::is_member_object_pointer_v<decltype(Ptrs)> && ...)
+          && (std::is_same_v<detail::member_class_t<Ptr>, detail::member_class_t<Ptrs>> && ...)
+    class soa_vector
+    {
+        using columns_type = std::tuple<
+            std::vector<detail::element_storage_t<detail::member_type_t<Ptr>>>,
+            std::vector<detail::element_storage_t<detail::member_type_t<Ptrs>>> ...
+        >;
+
+        static constexpr std::size_t column_count = sizeof... (Ptrs) + 1;
+
+        // Position of a member pointer in the list of columns, or column_count if it is not listed
+        template<auto P>
+        static constexpr std::size_t column_index = [] {
+            constexpr bool flags[] = {detail::same_member<P, Ptr>(), detail::same_member<P, Ptrs>() ...};
+            std::size_t index = 0;
+            while (index < column_count && !flags[index])
+                ++index;
+            return index;
+        }();
+
+        template<auto P>
+        static constexpr bool has_column = column_index<P> < column_count;
+
+        columns_type _columns;
+
+        template<std::size_t... Indices>
+        constexpr void grow(std::index_sequence<Indices ...>)
+        {
+            // Columns are reserved up front, so a failed allocation leaves all of them unchanged
+            std::size_t const needed = size() + 1;
+            ((std::get<Indices>(_columns).capacity() < needed
+                ? std::get<Indices>(_columns).reserve(needed < 8 ? 8 : 2 * size())
+                : void()), ...);
+        }
+
+        template<std::size_t... Indices, typename... Args>
+        constexpr void push(std::index_sequence<Indices ...> indices, Args &&... args)
+        {
+            grow(indices);
+            std::size_t pushed = 0;
+            try
+            {
+                ((std::get<Indices>(_columns).emplace_back(std::forward<Args>(args)), ++pushed), ...);
+            }
+            catch (...)
+            {
+                ((Indices < pushed ? std::get<Indices>(_columns).pop_back() : void()), ...);
+                throw;
+            }
+        }
+
+    public:
+        using value_type = detail::member_class_t<Ptr>;
+        using size_type = std::size_t;
+
+        /**
+         * Proxy object that refers to a single row of the container.
+         *
+         * @tparam Const    Whether the row is read-only
+         */
+        template<bool Const>
+        class basic_row
+        {
+            using container = std::conditional_t<Const, soa_vector const, soa_vector>;
+
+            container *_container;
+            size_type _index;
+
+        public:
+            constexpr basic_row(container &c, size_type index) noexcept : _container{&c}, _index{index} {}
+
+            constexpr basic_row(basic_row<false> const &other) noexcept requires Const
+                : _container{other._container}, _index{other._index} {}
+
+            template<auto P>
+            requires has_column<P>
+            [[nodiscard]] constexpr auto &get() const noexcept
+            {
+                return detail::stored_value(std::get<column_index<P>>(_container->_columns)[_index]);
+            }
+
+            /**
+             * Copies the stored members into a new object, leaving all other members default-initialized.
+             */
+            [[nodiscard]] constexpr value_type load() const requires std::is_default_constructible_v<value_type>
+            {
+                value_type obj{};
+                ((obj.*Ptr = get<Ptr>()), ..., (obj.*Ptrs = get<Ptrs>()));
+                return obj;
+            }
+
+            constexpr void store(value_type const &obj) const requires (!Const)
+            {
+                ((get<Ptr>() = obj.*Ptr), ..., (get<Ptrs>() = obj.*Ptrs));
+            }
+
+            friend class basic_row<true>;
+        };
+
+        using reference = basic_row<false>;
+        using const_reference = basic_row<true>;
+
+        [[nodiscard]] constexpr size_type size() const noexcept
+        {
+            return std::get<0>(_columns).size();
+        }
+
+        [[nodiscard]] constexpr bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+        constexpr void reserve(size_type capacity)
+        {
+            std::apply([=](auto &... columns) { (columns.reserve(capacity), ...); }, _columns);
+        }
+
+        constexpr void clear() noexcept
+        {
+            std::apply([](auto &... columns) { (columns.clear(), ...); }, _columns);
+        }
+
+        constexpr void push_back(value_type const &obj)
+        {
+            push(std::make_index_sequence<column_count>{}, obj.*Ptr, obj.*Ptrs ...);
+        }
+
+        /**
+         * Appends a row, constructing each column's element from the corresponding argument.
+         */
+        template<typename Arg, typename... Args>
+        requires (sizeof... (Args) == sizeof... (Ptrs))
+        constexpr void emplace_back(Arg &&arg, Args &&... args)
+        {
+            push(std::make_index_sequence<column_count>{}, std::forward<Arg>(arg), std::forward<Args>(args) ...);
+        }
+
+        constexpr void pop_back()
+        {
+            std::apply([](auto &... columns) { (columns.pop_back(), ...); }, _columns);
+        }
+
+        /**
+         * Removes a row, shifting all following rows of each column by one position.
+         */
+        constexpr void erase(size_type index)
+        {
+            std::apply([=](auto &... columns) {
+                (columns.erase(columns.begin() + static_cast<std::ptrdiff_t>(index)), ...);
+            }, _columns);
+        }
+
+        [[nodiscard]] constexpr reference operator[](size_type index) noexcept
+        {
+            return {*this, index};
+        }
+
+        [[nodiscard]] constexpr const_reference operator[](size_type index) const noexcept
+        {
+            return {*this, index};
+        }
+
+        [[nodiscard]] constexpr reference at(size_type index)
+        {
+            if (index >= size())
+                throw std::out_of_range{"soa_vector index out of range"};
+            return {*this, index};
+        }
+
+        [[nodiscard]] constexpr const_reference at(size_type index) const
+        {
+            if (index >= size())
+                throw std::out_of_range{"soa_vector index out of range"};
+            return {*this, index};
+        }
+
+        template<auto P>
+        requires has_column<P>
+        [[nodiscard]] constexpr std::span<detail::element_storage_t<detail::member_type_t<P>>> column() noexcept
+        {
+            return std::get<column_index<P>>(_columns);
+        }
+
+        template<auto P>
+        requires has_column<P>
+        [[nodiscard]] constexpr std::span<detail::element_storage_t<detail::member_type_t<P>> const> column() const noexcept
+        {
+            return std::get<column_index<P>>(_columns);
+        }
+    };
+}
+#endif //FUN_SOA_VECTOR_HPP
@@ -0,0 +1,286 @@
+#ifndef FUN_STRING_MATCH_HPP
+#define FUN_STRING_MATCH_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <fun/dispatch.hpp>
+#include <fun/overload.hpp>
+#include <fun/traits.hpp>
+#include <fun/utility.hpp>
+
+namespace fun
+{
+    namespace detail
+    {
+        template<typename>
+        struct string_tag_traits
+        {
+            static constexpr bool is_tag = false;
+            static constexpr std::string_view value{};
+        };
+
+        template<fixed_string Str>
+        struct string_tag_traits<string_tag<Str>>
+        {
+            static constexpr bool is_tag = true;
+            static constexpr std::string_view value = Str.view();
+        };
+
+        // The string tag taken by a matcher with a single call signature of one parameter, or void for all other matchers
+        template<typename F>
+        struct matcher_key : std::type_identity<void> {};
+
+        template<typename F>
+        requires (traits::signature_of<F>::arity == 1)
+        struct matcher_key<F> : std::remove_cvref<typename traits::signature_of<F>::template parameter<0>> {};
+
+        template<typename F>
+        using matcher_key_t = typename matcher_key<std::remove_cvref_t<F>>::type;
+
+        // Overload sets are flattened, so that the keys of their functions are found as well
+        template<typename F>
+        struct matcher_components : std::type_identity<std::tuple<F>> {};
+
+        template<typename... Fs>
+        struct matcher_components<overload_set<Fs ...>>
+            : std::type_identity<decltype(std::tuple_cat(std::declval<typename matcher_components<Fs>::type>() ...))> {};
+
+        // Number of leading characters hashed when they are enough to tell all keys apart
+        inline constexpr std::size_t hash_prefix_size = 8;
+
+        [[nodiscard]] constexpr std::uint64_t string_mix(std::uint64_t hash) noexcept
+        {
+            hash ^= hash >> 29;
+            hash *= 0xbf58476d1ce4e5b9;
+            hash ^= hash >> 32;
+            return hash;
+        }
+
+        // Packs the length and leading characters of a string into a single word
+        [[nodiscard]] constexpr std::uint64_t string_prefix(std::string_view str) noexcept
+        {
+            std::uint64_t word = 0;
+            std::size_t const size = str.size() < hash_prefix_size ? str.size() : hash_prefix_size;
+            for (std::size_t i = 0; i < size; ++i)
+                word |= std::uint64_t{static_cast<unsigned char>(str[i])} << (8 * i);
+            return word ^ (str.size() * 0x9e3779b97f4a7c15);
+        }
+
+        // FNV-1a over all characters, used when some keys share their prefix
+        [[nodiscard]] constexpr std::uint64_t string_fnv(std::string_view str) noexcept
+        {
+            std::uint64_t hash = 0xcbf29ce484222325;
+            for (char const c : str)
+            {
+                hash ^= static_cast<unsigned char>(c);
+                hash *= 0x100000001b3;
+            }
+            return hash;
+        }
+
+        // Seeds tried for each table size before doubling it
+        inline constexpr std::uint64_t max_hash_seeds = 256;
+
+        struct perfect_hash
+        {
+            std::size_t size = 1;
+            std::uint64_t seed = 0;
+            bool prefix_only = true;
+
+            [[nodiscard]] constexpr std::size_t slot(std::string_view str) const noexcept
+            {
+                std::uint64_t const hash = prefix_only ? string_prefix(str) : string_fnv(str);
+                return static_cast<std::size_t>(string_mix(hash ^ seed)) & (size - 1);
+            }
+        };
+
+        template<std::size_t Count>
+        constexpr bool is_perfect(std::array<std::string_view, Count> const &keys, perfect_hash hash)
+        {
+            for (std::size_t i = 0; i < Count; ++i)
+                for (std::size_t j = i + 1; j < Count; ++j)
+                    if (hash.slot(keys[i]) == hash.slot(keys[j]))
+                        return false;
+            return true;
+        }
+
+        /**
+         * Searches for a seed that maps all keys to distinct slots of a power of 2 sized table.
+         * Only the length and leading characters are hashed, unless they are the same for two keys.
+         * Each time the seeds run out, the table size is doubled, making collisions less likely.
+         */
+        template<std::size_t Count>
+        constexpr perfect_hash find_perfect_hash(std::array<std::string_view, Count> const &keys)
+        {
+            for (std::size_t i = 0; i < Count; ++i)
+                for (std::size_t j = i + 1; j < Count; ++j)
+                    if (keys[i] == keys[j])
+                        throw std::invalid_argument{"duplicate string tags"};
+
+            perfect_hash hash{};
+            for (std::size_t i = 0; i < Count; ++i)
+                for (std::size_t j = i + 1; j < Count; ++j)
+                    if (string_prefix(keys[i]) == string_prefix(keys[j]))
+                        hash.prefix_only = false;
+
+            while (hash.size < Count)
+                hash.size *= 2;
+
+            for (; hash.size <= max_dispatch_size; hash.size *= 2)
+                for (hash.seed = 0; hash.seed < max_hash_seeds; ++hash.seed)
+                    if (is_perfect(keys, hash))
+                        return hash;
+
+            throw std::invalid_argument{"no perfect hash found for the string tags"};
+        }
+
+        template<typename... Fs>
+        struct string_matcher
+        {
+            using keys_type = std::tuple<matcher_key_t<Fs> ...>;
+
+            static constexpr bool is_key[] = {string_tag_traits<matcher_key_t<Fs>>::is_tag ..., false};
+
+            static constexpr std::string_view values[] = {string_tag_traits<matcher_key_t<Fs>>::value ..., {}};
+
+            static constexpr std::size_t key_count = (string_tag_traits<matcher_key_t<Fs>>::is_tag + ... + 0);
+
+            // Marks slots of the table that do not hold any key
+            static constexpr std::size_t no_key = sizeof... (Fs);
+
+            static constexpr auto keys = [] {
+                std::array<std::string_view, key_count> result{};
+                std::size_t i = 0;
+                for (std::size_t j = 0; j < sizeof... (Fs); ++j)
+                    if (is_key[j])
+                        result[i++] = values[j];
+                return result;
+            }();
+
+            static constexpr perfect_hash hash = find_perfect_hash(keys);
+
+            // Index of the matcher whose key hashes to each slot
+            static constexpr auto slots = [] {
+                std::array<std::size_t, hash.size> result{};
+                result.fill(no_key);
+                for (std::size_t i = 0; i < sizeof... (Fs); ++i)
+                    if (is_key[i])
+                        result[hash.slot(values[i])] = i;
+                return result;
+            }();
+
+            template<std::size_t Slot>
+            using key_at = std::tuple_element_t<slots[Slot], keys_type>;
+        };
+
+        template<typename>
+        struct string_matcher_for;
+
+        template<typename... Fs>
+        struct string_matcher_for<std::tuple<Fs ...>> : std::type_identity<string_matcher<Fs ...>> {};
+
+        template<typename R, typename F>
+        constexpr R string_fallback(F &&f, std::string_view str)
+        {
+            if constexpr (std::is_invocable_v<F, std::string_view>)
+                return std::invoke(std::forward<F>(f), str);
+            else
+                throw std::out_of_range{"no string tag matches the value"};
+        }
+
+        template<typename Matcher, typename F>
+        struct string_match_result_impl
+        {
+            static constexpr auto deduce() noexcept
+            {
+                if constexpr (Matcher::key_count > 0)
+                {
+                    constexpr std::size_t first = [] {
+                        std::size_t i = 0;
+                        while (!Matcher::is_key[i])
+                            ++i;
+                        return i;
+                    }();
+                    return std::type_identity<
+                        std::invoke_result_t<F, std::tuple_element_t<first, typename Matcher::keys_type>>
+                    >{};
+                }
+                else if constexpr (std::is_invocable_v<F, std::string_view>)
+                {
+                    return std::type_identity<std::invoke_result_t<F, std::string_view>>{};
+                }
+                else
+                {
+                    return std::type_identity<void>{};
+                }
+            }
+
+            using type = typename decltype(deduce())::type;
+        };
+
+        template<typename Matcher, typename F>
+        constexpr decltype(auto) string_match_overload(std::string_view str, F &&f)
+        {
+            using result = typename string_match_result_impl<Matcher, F>::type;
+            constexpr auto hash = Matcher::hash;
+
+            if constexpr (Matcher::key_count == 0)
+            {
+                return string_fallback<result>(std::forward<F>(f), str);
+            }
+            else
+            {
+                return visit_index<result, hash.size>(hash.slot(str), [&]<std::size_t Slot>() -> result {
+                    if constexpr (Matcher::slots[Slot] == Matcher::no_key)
+                    {
+                        return string_fallback<result>(std::forward<F>(f), str);
+                    }
+                    else
+                    {
+                        using key = typename Matcher::template key_at<Slot>;
+                        static_assert(
+                            std::is_same_v<std::invoke_result_t<F, key>, result>,
+                            "all matchers must return the same type"
+                        );
+
+                        if (str == key::value)
+                            return std::invoke(std::forward<F>(f), key{});
+                        return string_fallback<result>(std::forward<F>(f), str);
+                    }
+                });
+            }
+        }
+    }
+
+    /**
+     * Matches a string against the string tags taken by a list of functions, using a perfect hash
+     * generated at compile time. At runtime, the string is hashed once, compared against the only key
+     * that hashes to the same slot, and dispatched through a single jump.
+     * Functions with a single call signature whose first parameter is a string_tag provide the keys,
+     * including the ones inside of overload sets.
+     * All other functions are fallbacks, which are invoked with the original string when no key matches.
+     * Without a fallback, std::out_of_range is thrown instead.
+     *
+     * @tparam Fs   The types of the matching functions
+     * @param str   The string being matched
+     * @param fs    The functions used to match the string
+     * @return      The result of matching the string against the functions
+     */
+    template<traits::callable... Fs>
+    [[nodiscard]] constexpr decltype(auto) string_match(std::string_view str, Fs &&... fs)
+    {
+        using components = decltype(std::tuple_cat(
+            std::declval<typename detail::matcher_components<std::remove_cvref_t<Fs>>::type>() ...
+        ));
+        using matcher = typename detail::string_matcher_for<components>::type;
+        return detail::string_match_overload<matcher>(str, overload(std::forward<Fs>(fs) ...));
+    }
+}
+#endif //FUN_STRING_MATCH_HPP
@@ -0,0 +1,95 @@
+#ifndef FUN_TABULATE_HPP
+#define FUN_TABULATE_HPP
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <fun/dispatch.hpp>
+#include <fun/utility.hpp>
+
+namespace fun
+{
+    /**
+     * Callable lookup table holding the results of a function for all values in the range [Min, Max].
+     * Runtime values are bounds-checked and throw std::out_of_range, tags are checked at compile time.
+     *
+     * @tparam Min  The smallest value in the table
+     * @tparam Max  The largest value in the table
+     * @tparam T    The type of the stored results
+     */
+    template<std::intmax_t Min, std::intmax_t Max, typename T>
+    class tabulated
+    {
+        using space = detail::tag_space<Min, Max, 1>;
+
+    public:
+        using table_type = std::array<T, space::size>;
+
+        constexpr explicit tabulated(table_type const &table) noexcept(std::is_nothrow_copy_constructible_v<T>)
+            : _table{table} {}
+
+        template<std::integral Int>
+        [[nodiscard]] constexpr T const &operator()(Int value) const
+        {
+            if (!space::contains(value))
+                throw std::out_of_range{"tabulated value out of range"};
+            return _table[space::flatten(value)];
+        }
+
+        template<std::intmax_t I>
+        requires (I >= Min && I <= Max)
+        [[nodiscard]] constexpr T const &operator()(tag<I>) const noexcept
+        {
+            return _table[static_cast<std::size_t>(I - Min)];
+        }
+
+        [[nodiscard]] constexpr table_type const &table() const noexcept
+        {
+            return _table;
+        }
+
+    private:
+        table_type _table;
+    };
+
+    namespace detail
+    {
+        template<std::intmax_t Min, typename F>
+        using tabulate_result = std::remove_cvref_t<std::invoke_result_t<F &, tag<Min>>>;
+
+        template<std::intmax_t Min, typename T, typename F, std::size_t... Indices>
+        constexpr auto make_table(F &f, std::index_sequence<Indices ...>)
+        {
+            return std::array<T, sizeof... (Indices)>{
+                static_cast<T>(std::invoke(f, tag<Min + static_cast<std::intmax_t>(Indices)>{})) ...
+            };
+        }
+    }
+
+    /**
+     * Evaluates a function for all values in the range [Min, Max] at compile time and stores the results in a table.
+     * The function is invoked with tag<I>, which also converts to std::intmax_t, so it may take either one.
+     * All results must be convertible to the type returned for Min.
+     *
+     * @tparam Min  The smallest value in the table
+     * @tparam Max  The largest value in the table
+     * @tparam F    The type of the tabulated function
+     * @param f     The tabulated function, which must be usable in constant expressions
+     * @return      A callable object that looks up the results in the table
+     */
+    template<std::intmax_t Min, std::intmax_t Max, typename F>
+    [[nodiscard]] consteval auto tabulate(F f)
+    {
+        using result = detail::tabulate_result<Min, F>;
+        using table = typename tabulated<Min, Max, result>::table_type;
+
+        return tabulated<Min, Max, result>{
+            detail::make_table<Min, result>(f, std::make_index_sequence<std::tuple_size_v<table>>{})
+        };
+    }
+}
+#endif //FUN_TABULATE_HPP
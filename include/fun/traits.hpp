@@ -2,6 +2,7 @@
 #define FUN_TRAITS_HPP
 
 #include <functional>
+#include <tuple>
 #include <type_traits>
 #include <fun/utility.hpp>
 
@@ -13,14 +14,119 @@ namespace fun::traits
     template<typename T>
     using is_function = std::is_function<std::remove_pointer_t<std::remove_reference_t<T>>>;
 
+    // Value used by traits when the number of parameters of a callable cannot be determined
+    inline constexpr std::size_t unknown_arity = static_cast<std::size_t>(-1);
+
     namespace detail
     {
+        struct unknown_signature
+        {
+            static constexpr bool known = false;
+            static constexpr std::size_t arity = unknown_arity;
+        };
+
+        template<bool Noexcept, bool ConstInvocable, bool LvalueInvocable, typename R, typename... Args>
+        struct known_signature
+        {
+            static constexpr bool known = true;
+            static constexpr std::size_t arity = sizeof... (Args);
+            static constexpr bool is_noexcept = Noexcept;
+
+            // Whether the call operator can be invoked on const objects and on lvalues, always true for functions
+            static constexpr bool const_invocable = ConstInvocable;
+            static constexpr bool lvalue_invocable = LvalueInvocable;
+
+            using type = R(Args ...);
+            using result_type = R;
+            using parameters = std::tuple<Args ...>;
+
+            template<std::size_t I>
+            using parameter = std::tuple_element_t<I, parameters>;
+        };
+
+        template<typename>
+        struct operator_signature_impl : unknown_signature {};
+
+        template<typename R, typename C, typename... Args>
+        struct operator_signature_impl<R (C::*)(Args ...)> : known_signature<false, false, true, R, Args ...> {};
+
+        template<typename R, typename C, typename... Args>
+        struct operator_signature_impl<R (C::*)(Args ...) noexcept> : known_signature<true, false, true, R, Args ...> {};
+
+        template<typename R, typename C, typename... Args>
+        struct operator_signature_impl<R (C::*)(Args ...) const> : known_signature<false, true, true, R, Args ...> {};
+
+        template<typename R, typename C, typename... Args>
+        struct operator_signature_impl<R (C::*)(Args ...) const noexcept> : known_signature<true, true, true, R, Args ...> {};
+
+        template<typename R, typename C, typename... Args>
+        struct operator_signature_impl<R (C::*)(Args ...) &> : known_signature<false, false, true, R, Args ...> {};
+
+        template<typename R, typename C, typename... Args>
+        struct operator_signature_impl<R (C::*)(Args ...) & noexcept> : known_signature<true, false, true, R, Args ...> {};
+
+        template<typename R, typename C, typename... Args>
+        struct operator_signature_impl<R (C::*)(Args ...) const &> : known_signature<false, true, true, R, Args ...> {};
+
+        template<typename R, typename C, typename... Args>
+        struct operator_signature_impl<R (C::*)(Args ...) const & noexcept> : known_signature<true, true, true, R, Args ...> {};
+
+        template<typename R, typename C, typename... Args>
+        struct operator_signature_impl<R (C::*)(Args ...) &&> : known_signature<false, false, false, R, Args ...> {};
+
+        template<typename R, typename C, typename... Args>
+        struct operator_signature_impl<R (C::*)(Args ...) && noexcept> : known_signature<true, false, false, R, Args ...> {};
+
+        template<typename R, typename C, typename... Args>
+        struct operator_signature_impl<R (C::*)(Args ...) const &&> : known_signature<false, true, false, R, Args ...> {};
+
+        template<typename R, typename C, typename... Args>
+        struct operator_signature_impl<R (C::*)(Args ...) const && noexcept> : known_signature<true, true, false, R, Args ...> {};
+
+        template<typename F>
+        struct signature_of_impl : unknown_signature {};
+
+        template<typename R, typename... Args>
+        struct signature_of_impl<R(Args ...)> : known_signature<false, true, true, R, Args ...> {};
+
+        template<typename R, typename... Args>
+        struct signature_of_impl<R(Args ...) noexcept> : known_signature<true, true, true, R, Args ...> {};
+
+        template<typename F>
+        requires std::is_pointer_v<F> || std::is_reference_v<F>
+        struct signature_of_impl<F> : signature_of_impl<std::remove_cv_t<std::remove_pointer_t<std::remove_reference_t<F>>>> {};
+
+        // Only classes with exactly one non-template operator() have a known signature
+        template<typename F>
+        requires std::is_class_v<F> && requires { &F::operator(); }
+        struct signature_of_impl<F> : operator_signature_impl<decltype(&F::operator())> {};
+    }
+
+    /**
+     * Type trait that describes the call signature of a non-generic callable: its arity, parameter types
+     * and return type. Generic, overloaded and C-style variadic callables have an unknown signature.
+     * It is computed once for each callable type, regardless of its cv and reference qualifiers,
+     * so other traits query it first and only probe invocations when it is unknown.
+     *
+     * @tparam F    The callable type
+     */
+    template<typename F>
+    using signature_of = detail::signature_of_impl<std::remove_cvref_t<F>>;
+
+    namespace detail
+    {
+        template<typename F>
+        concept class_type = std::is_class_v<F>;
+
+        template<typename F>
+        concept known_signature_class = class_type<F> && signature_of<F>::known;
+
         template<typename F>
         struct is_callable_impl : is_function<F> {};
 
         // This is some black magic
         template<typename F>
-        requires std::is_class_v<F>
+        requires class_type<F>
         struct is_callable_impl<F>
         {
             struct fallback
@@ -42,6 +148,11 @@ namespace fun::traits
             using type = decltype(check<derived>(nullptr));
             static constexpr bool value = type{};
         };
+
+        // Classes with a single call operator need no probing
+        template<typename F>
+        requires known_signature_class<F>
+        struct is_callable_impl<F> : std::true_type {};
     }
 
     /**
@@ -61,6 +172,12 @@ namespace fun::traits
 
     namespace detail
     {
+        // Lvalues of F can be passed to its call operator, whose signature is known
+        template<typename F>
+        concept known_lvalue_signature = signature_of<F>::known && signature_of<F>::lvalue_invocable
+            && (signature_of<F>::const_invocable || !std::is_const_v<std::remove_reference_t<F>>)
+            && !std::is_volatile_v<std::remove_reference_t<F>>;
+
         template<typename, typename>
         struct is_callable_with_arity_impl;
 
@@ -71,6 +188,13 @@ namespace fun::traits
                 std::invoke(f, lvalue<Indices>() ...);
             };
         };
+
+        template<typename F, std::size_t... Indices>
+        requires known_lvalue_signature<F>
+        struct is_callable_with_arity_impl<F, std::index_sequence<Indices ...>>
+        {
+            static constexpr bool value = signature_of<F>::arity == sizeof... (Indices);
+        };
     }
 
     /**
@@ -90,5 +214,17 @@ namespace fun::traits
 
     template<typename F, std::size_t N>
     concept callable_with_arity = is_callable_with_arity_v<F, N>;
+
+    /**
+     * Type trait that determines the number of parameters of a callable with a single call signature,
+     * without probing any invocations. Generic or overloaded callables have an unknown_arity.
+     *
+     * @tparam F    The callable type
+     */
+    template<typename F>
+    using call_arity = std::integral_constant<std::size_t, signature_of<F>::arity>;
+
+    template<typename F>
+    inline constexpr std::size_t call_arity_v = signature_of<F>::arity;
 }
 #endif //FUN_TRAITS_HPP
\ No newline at end of file
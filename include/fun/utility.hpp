@@ -1,14 +1,55 @@
 #ifndef FUN_UTILITY_HPP
 #define FUN_UTILITY_HPP
 
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
 #include <fun/any.hpp>
 
+// MSVC ignores the standard attribute to keep its ABI, but honors its own spelling
+#if defined(_MSC_VER)
+#define FUN_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#else
+#define FUN_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
+
 namespace fun
 {
     // Mechanism used to associate an integral value with a type
     template<std::intmax_t ID>
     struct tag : std::integral_constant<std::intmax_t, ID>{};
 
+    // String literal that can be used as a template argument
+    template<std::size_t N>
+    struct fixed_string
+    {
+        char chars[N]{};
+
+        constexpr fixed_string(char const (&str)[N]) noexcept
+        {
+            for (std::size_t i = 0; i < N; ++i)
+                chars[i] = str[i];
+        }
+
+        [[nodiscard]] constexpr std::string_view view() const noexcept
+        {
+            return {chars, N - 1};
+        }
+    };
+
+    // Mechanism used to associate a string with a type
+    template<fixed_string Str>
+    struct string_tag
+    {
+        static constexpr std::string_view value = Str.view();
+
+        constexpr operator std::string_view() const noexcept
+        {
+            return value;
+        }
+    };
+
     // Utility functions used to get rvalues or lvalues of any type (in an unevaluated context)
     template<typename T> constexpr auto rvalue() noexcept -> decltype(std::declval<T>());
     template<typename T> constexpr auto lvalue() noexcept -> decltype(std::declval<T &>());
@@ -18,5 +59,62 @@ namespace fun
     template<std::size_t = 0> constexpr auto lvalue() noexcept -> any &;
 
     inline constexpr auto noop = []() noexcept {};
+
+    /**
+     * A bool that takes a whole byte, used by containers that store elements in std::vector,
+     * since std::vector<bool> packs its elements into bits that cannot be referenced or viewed as a span.
+     */
+    struct boolean
+    {
+        bool value = false;
+
+        constexpr boolean() noexcept = default;
+
+        constexpr explicit(false) boolean(bool b) noexcept : value{b} {}
+
+        constexpr explicit(false) operator bool &() noexcept { return value; }
+
+        constexpr explicit(false) operator bool const &() const noexcept { return value; }
+    };
+
+    namespace detail
+    {
+        [[noreturn]] inline void unreachable() noexcept
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            __assume(false);
+#else
+            __builtin_unreachable();
+#endif
+        }
+
+        // Type of the elements of std::vector that hold values of type T
+        template<typename T>
+        using element_storage_t = std::conditional_t<std::is_same_v<T, bool>, boolean, T>;
+
+        // Reference to a stored value, which unwraps booleans
+        template<typename Element>
+        [[nodiscard]] constexpr auto &stored_value(Element &element) noexcept
+        {
+            if constexpr (std::is_same_v<std::remove_const_t<Element>, boolean>)
+                return element.value;
+            else
+                return element;
+        }
+
+        [[nodiscard]] constexpr std::size_t hash_combine(std::size_t seed, std::size_t hash) noexcept
+        {
+            return seed ^ (hash + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+        }
+
+        // Spreads the bits of a hash value, since std::hash is the identity function for integers
+        [[nodiscard]] constexpr std::size_t hash_mix(std::size_t hash) noexcept
+        {
+            hash ^= hash >> 33;
+            hash *= 0xff51afd7ed558ccd;
+            hash ^= hash >> 33;
+            return hash;
+        }
+    }
 }
 #endif //FUN_UTILITY_HPP
\ No newline at end of file
@@ -0,0 +1,583 @@
+#ifndef FUN_VARIANT_HPP
+#define FUN_VARIANT_HPP
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <fun/dispatch.hpp>
+
+namespace fun
+{
+    template<typename... Ts>
+    class variant;
+
+    namespace detail
+    {
+        // Smallest unsigned type that holds all indices and the valueless marker, which is equal to Count
+        template<std::size_t Count>
+        using variant_index_t = std::conditional_t<
+            Count <= 0xff,
+            std::uint8_t,
+            std::conditional_t<Count <= 0xffff, std::uint16_t, std::uint32_t>
+        >;
+
+        template<typename T, typename... Ts>
+        inline constexpr std::size_t alternative_index = [] {
+            constexpr bool flags[] = {std::is_same_v<T, Ts> ...};
+            std::size_t index = 0;
+            while (index < sizeof... (Ts) && !flags[index])
+                ++index;
+            return index;
+        }();
+
+        template<typename T, typename... Ts>
+        inline constexpr bool is_unique_alternative = (std::is_same_v<T, Ts> + ... + 0) == 1;
+
+        template<typename... Ts>
+        union variant_union
+        {
+            constexpr variant_union() noexcept {}
+        };
+
+        /**
+         * Recursive union of all alternatives, which can be used in constant expressions.
+         */
+        template<typename T, typename... Ts>
+        union variant_union<T, Ts ...>
+        {
+            T head;
+            variant_union<Ts ...> tail;
+
+            constexpr variant_union() noexcept : tail{} {}
+
+            template<typename... Args>
+            constexpr explicit variant_union(std::in_place_index_t<0>, Args &&... args)
+                : head(std::forward<Args>(args) ...) {}
+
+            template<std::size_t I, typename... Args>
+            constexpr explicit variant_union(std::in_place_index_t<I>, Args &&... args)
+                : tail(std::in_place_index<I - 1>, std::forward<Args>(args) ...) {}
+
+            constexpr variant_union(variant_union const &) = default;
+            constexpr variant_union(variant_union &&) = default;
+            constexpr variant_union &operator=(variant_union const &) = default;
+            constexpr variant_union &operator=(variant_union &&) = default;
+
+            constexpr ~variant_union() requires (std::is_trivially_destructible_v<T> && (std::is_trivially_destructible_v<Ts> && ...)) = default;
+
+            constexpr ~variant_union() {}
+
+            template<std::size_t I, typename Self>
+            static constexpr auto &get(Self &self) noexcept
+            {
+                if constexpr (I == 0)
+                    return self.head;
+                else
+                    return std::remove_cvref_t<decltype(self.tail)>::template get<I - 1>(self.tail);
+            }
+        };
+
+        /**
+         * Storage for any alternatives, with the index kept in the smallest integer type that fits.
+         * Special members are trivial whenever they are trivial for all alternatives.
+         */
+        template<typename... Ts>
+        class variant_storage
+        {
+            static constexpr std::size_t valueless_index = sizeof... (Ts);
+
+            variant_union<Ts ...> _union;
+            variant_index_t<sizeof... (Ts)> _index = valueless_index;
+
+            template<typename Other>
+            constexpr void construct_from(Other &&other)
+            {
+                if (!other.valueless())
+                {
+                    visit_index<void, sizeof... (Ts)>(other.index(), [&]<std::size_t I>() {
+                        emplace<I>(std::forward<Other>(other).template get<I>());
+                    });
+                }
+            }
+
+            template<typename Other>
+            constexpr void assign_from(Other &&other)
+            {
+                if (other.valueless())
+                {
+                    reset();
+                }
+                else if (_index == other._index)
+                {
+                    visit_index<void, sizeof... (Ts)>(other.index(), [&]<std::size_t I>() {
+                        get<I>() = std::forward<Other>(other).template get<I>();
+                    });
+                }
+                else
+                {
+                    reset();
+                    construct_from(std::forward<Other>(other));
+                }
+            }
+
+            static constexpr bool copyable = (std::is_copy_constructible_v<Ts> && ...);
+            static constexpr bool movable = (std::is_move_constructible_v<Ts> && ...);
+            static constexpr bool trivially_copyable = (std::is_trivially_copyable_v<Ts> && ...) && copyable;
+            static constexpr bool trivially_movable = (std::is_trivially_copyable_v<Ts> && ...) && movable;
+
+        public:
+            static constexpr bool is_packed = false;
+
+            template<std::size_t I, typename... Args>
+            constexpr explicit variant_storage(std::in_place_index_t<I> in_place, Args &&... args)
+                : _union(in_place, std::forward<Args>(args) ...), _index{I} {}
+
+            constexpr variant_storage(variant_storage const &) requires trivially_copyable = default;
+
+            constexpr variant_storage(variant_storage const &other) requires (!trivially_copyable && copyable)
+            {
+                construct_from(other);
+            }
+
+            constexpr variant_storage(variant_storage &&) requires trivially_movable = default;
+
+            constexpr variant_storage(variant_storage &&other) noexcept((std::is_nothrow_move_constructible_v<Ts> && ...))
+                requires (!trivially_movable && movable)
+            {
+                construct_from(std::move(other));
+            }
+
+            constexpr variant_storage &operator=(variant_storage const &) requires trivially_copyable = default;
+
+            constexpr variant_storage &operator=(variant_storage const &other)
+                requires (!trivially_copyable && copyable && (std::is_copy_assignable_v<Ts> && ...))
+            {
+                if (this != &other)
+                    assign_from(other);
+                return *this;
+            }
+
+            constexpr variant_storage &operator=(variant_storage &&) requires trivially_movable = default;
+
+            constexpr variant_storage &operator=(variant_storage &&other)
+                noexcept(((std::is_nothrow_move_assignable_v<Ts> && std::is_nothrow_move_constructible_v<Ts>) && ...))
+                requires (!trivially_movable && movable && (std::is_move_assignable_v<Ts> && ...))
+            {
+                if (this != &other)
+                    assign_from(std::move(other));
+                return *this;
+            }
+
+            constexpr ~variant_storage() requires (std::is_trivially_destructible_v<Ts> && ...) = default;
+
+            constexpr ~variant_storage()
+            {
+                reset();
+            }
+
+            [[nodiscard]] constexpr std::size_t index() const noexcept
+            {
+                return _index == valueless_index ? std::variant_npos : _index;
+            }
+
+            [[nodiscard]] constexpr bool valueless() const noexcept
+            {
+                return _index == valueless_index;
+            }
+
+            template<std::size_t I>
+            [[nodiscard]] constexpr auto &get() & noexcept
+            {
+                return variant_union<Ts ...>::template get<I>(_union);
+            }
+
+            template<std::size_t I>
+            [[nodiscard]] constexpr auto const &get() const & noexcept
+            {
+                return variant_union<Ts ...>::template get<I>(_union);
+            }
+
+            template<std::size_t I>
+            [[nodiscard]] constexpr auto &&get() && noexcept
+            {
+                return std::move(variant_union<Ts ...>::template get<I>(_union));
+            }
+
+            template<std::size_t I>
+            [[nodiscard]] constexpr auto const &&get() const && noexcept
+            {
+                return std::move(variant_union<Ts ...>::template get<I>(_union));
+            }
+
+            constexpr void reset() noexcept
+            {
+                if constexpr (!(std::is_trivially_destructible_v<Ts> && ...))
+                {
+                    if (!valueless())
+                    {
+                        visit_index<void, sizeof... (Ts)>(_index, [&]<std::size_t I>() {
+                            std::destroy_at(std::addressof(get<I>()));
+                        });
+                    }
+                }
+                _index = valueless_index;
+            }
+
+            // The variant is left valueless if the construction throws
+            template<std::size_t I, typename... Args>
+            constexpr void emplace(Args &&... args)
+            {
+                reset();
+                std::construct_at(std::addressof(_union), std::in_place_index<I>, std::forward<Args>(args) ...);
+                _index = static_cast<variant_index_t<sizeof... (Ts)>>(I);
+            }
+        };
+
+        template<typename T>
+        concept aligned_object_pointer = std::is_pointer_v<T> && std::is_object_v<std::remove_pointer_t<T>>
+            && requires { sizeof(std::remove_pointer_t<T>); };
+
+        /**
+         * Storage for pointers to types aligned to at least as many bytes as there are alternatives.
+         * The index is kept in the low bits of the pointer, which are always zero, so the variant takes
+         * the size of a single pointer. Alternatives are returned by value.
+         */
+        template<typename... Ts>
+        class tagged_pointer_storage
+        {
+            static constexpr std::uintptr_t mask = std::bit_ceil(sizeof... (Ts)) - 1;
+
+            std::uintptr_t _word;
+
+        public:
+            static constexpr bool is_packed = true;
+
+            static constexpr bool is_viable = sizeof... (Ts) > 1 && (aligned_object_pointer<Ts> && ...)
+                && ((alignof(std::remove_pointer_t<Ts>) > mask) && ...);
+
+            // The pointer is converted to the alternative first, so its low bits are known to be free
+            template<std::size_t I, typename P>
+            requires std::is_convertible_v<P, std::tuple_element_t<I, std::tuple<Ts ...>>>
+            explicit tagged_pointer_storage(std::in_place_index_t<I>, P ptr) noexcept
+                : _word{reinterpret_cast<std::uintptr_t>(static_cast<std::tuple_element_t<I, std::tuple<Ts ...>>>(ptr)) | I} {}
+
+            template<std::size_t I>
+            explicit tagged_pointer_storage(std::in_place_index_t<I>) noexcept : _word{I} {}
+
+            [[nodiscard]] std::size_t index() const noexcept
+            {
+                return static_cast<std::size_t>(_word & mask);
+            }
+
+            [[nodiscard]] static constexpr bool valueless() noexcept
+            {
+                return false;
+            }
+
+            template<std::size_t I>
+            [[nodiscard]] auto get() const noexcept
+            {
+                using pointer = std::tuple_element_t<I, std::tuple<Ts ...>>;
+                return reinterpret_cast<pointer>(_word & ~mask);
+            }
+
+            template<std::size_t I, typename... Args>
+            void emplace(Args &&... args) noexcept
+            {
+                *this = tagged_pointer_storage{std::in_place_index<I>, std::forward<Args>(args) ...};
+            }
+        };
+
+        template<typename T>
+        concept nan_boxable = std::is_trivially_copyable_v<T> && !std::is_same_v<T, double>
+            && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4);
+
+        template<std::size_t Size>
+        using unsigned_of_size = std::conditional_t<
+            Size == 1,
+            std::uint8_t,
+            std::conditional_t<Size == 2, std::uint16_t, std::uint32_t>
+        >;
+
+        /**
+         * Storage for a double together with small trivially copyable alternatives of up to 4 bytes.
+         * The other alternatives are boxed inside of negative quiet NaNs, with their index above the payload,
+         * so the variant takes 8 bytes. All NaN doubles are stored as the same positive quiet NaN.
+         * Alternatives are returned by value.
+         */
+        template<typename... Ts>
+        class nan_boxed_storage
+        {
+            static constexpr std::uint64_t box_mask = 0xfff8'0000'0000'0000;
+            static constexpr std::uint64_t canonical_nan = 0x7ff8'0000'0000'0000;
+            static constexpr std::size_t double_index = alternative_index<double, Ts ...>;
+
+            std::uint64_t _word;
+
+            template<std::size_t I, typename T>
+            static constexpr std::uint64_t box(T value) noexcept
+            {
+                if constexpr (I == double_index)
+                {
+                    double const d = value;
+                    return d != d ? canonical_nan : std::bit_cast<std::uint64_t>(d);
+                }
+                else
+                {
+                    using alternative = std::tuple_element_t<I, std::tuple<Ts ...>>;
+                    auto const bits = std::bit_cast<unsigned_of_size<sizeof(alternative)>>(static_cast<alternative>(value));
+                    return box_mask | (std::uint64_t{I} << 32) | bits;
+                }
+            }
+
+        public:
+            static constexpr bool is_packed = true;
+
+            static constexpr bool is_viable = is_unique_alternative<double, Ts ...> && sizeof... (Ts) > 1
+                && sizeof... (Ts) <= 0x7ffff && ((std::is_same_v<Ts, double> || nan_boxable<Ts>) && ...);
+
+            template<std::size_t I, typename T>
+            constexpr explicit nan_boxed_storage(std::in_place_index_t<I>, T &&value) noexcept
+                : _word{box<I>(std::forward<T>(value))} {}
+
+            template<std::size_t I>
+            constexpr explicit nan_boxed_storage(std::in_place_index_t<I>) noexcept
+                : _word{box<I>(std::tuple_element_t<I, std::tuple<Ts ...>>{})} {}
+
+            [[nodiscard]] constexpr std::size_t index() const noexcept
+            {
+                return (_word & box_mask) == box_mask ? static_cast<std::size_t>(_word >> 32 & 0x7ffff) : double_index;
+            }
+
+            [[nodiscard]] static constexpr bool valueless() noexcept
+            {
+                return false;
+            }
+
+            template<std::size_t I>
+            [[nodiscard]] constexpr auto get() const noexcept
+            {
+                using alternative = std::tuple_element_t<I, std::tuple<Ts ...>>;
+                if constexpr (I == double_index)
+                    return std::bit_cast<double>(_word);
+                else
+                    return std::bit_cast<alternative>(static_cast<unsigned_of_size<sizeof(alternative)>>(_word));
+            }
+
+            template<std::size_t I, typename... Args>
+            constexpr void emplace(Args &&... args) noexcept
+            {
+                *this = nan_boxed_storage{std::in_place_index<I>, std::forward<Args>(args) ...};
+            }
+        };
+
+        template<typename... Ts>
+        using variant_storage_for = std::conditional_t<
+            tagged_pointer_storage<Ts ...>::is_viable,
+            tagged_pointer_storage<Ts ...>,
+            std::conditional_t<nan_boxed_storage<Ts ...>::is_viable, nan_boxed_storage<Ts ...>, variant_storage<Ts ...>>
+        >;
+    }
+
+    /**
+     * A discriminated union that takes as little space as possible.
+     * The index is stored in the smallest integer type that can hold it. When all alternatives are pointers
+     * to sufficiently aligned types, the index is stored in the unused low bits of the pointer instead, and
+     * a double can share its NaN bits with other alternatives of up to 4 bytes. In these packed forms,
+     * alternatives are returned by value, so they cannot be modified in place.
+     * Variants are matched with fun::match or fun::match_all, just like std::variant.
+     *
+     * @tparam Ts   The types of the alternatives, which must be distinct
+     */
+    template<typename... Ts>
+    class variant
+    {
+        static_assert(sizeof... (Ts) > 0, "a variant needs at least one alternative");
+        static_assert(((detail::is_unique_alternative<Ts, Ts ...>) && ...), "the alternatives must be distinct");
+        static_assert(((std::is_object_v<Ts> && !std::is_array_v<Ts>) && ...), "the alternatives must be non-array objects");
+
+        using storage_type = detail::variant_storage_for<Ts ...>;
+
+        storage_type _storage;
+
+    public:
+        // Whether the alternatives share their bits with the index, and are returned by value
+        static constexpr bool is_packed = storage_type::is_packed;
+
+        constexpr variant() noexcept(std::is_nothrow_default_constructible_v<std::tuple_element_t<0, std::tuple<Ts ...>>>)
+            requires std::is_default_constructible_v<std::tuple_element_t<0, std::tuple<Ts ...>>>
+            : _storage(std::in_place_index<0>) {}
+
+        template<typename T>
+        requires detail::is_unique_alternative<std::remove_cvref_t<T>, Ts ...>
+        constexpr variant(T &&value) noexcept(std::is_nothrow_constructible_v<std::remove_cvref_t<T>, T &&>)
+            : _storage(std::in_place_index<detail::alternative_index<std::remove_cvref_t<T>, Ts ...>>, std::forward<T>(value)) {}
+
+        template<std::size_t I, typename... Args>
+        requires (I < sizeof... (Ts)) && std::is_constructible_v<std::tuple_element_t<I, std::tuple<Ts ...>>, Args ...>
+        constexpr explicit variant(std::in_place_index_t<I> in_place, Args &&... args)
+            : _storage(in_place, std::forward<Args>(args) ...) {}
+
+        template<typename T, typename... Args>
+        requires detail::is_unique_alternative<T, Ts ...> && std::is_constructible_v<T, Args ...>
+        constexpr explicit variant(std::in_place_type_t<T>, Args &&... args)
+            : _storage(std::in_place_index<detail::alternative_index<T, Ts ...>>, std::forward<Args>(args) ...) {}
+
+        template<typename T>
+        requires detail::is_unique_alternative<std::remove_cvref_t<T>, Ts ...>
+        constexpr variant &operator=(T &&value)
+        {
+            _storage.template emplace<detail::alternative_index<std::remove_cvref_t<T>, Ts ...>>(std::forward<T>(value));
+            return *this;
+        }
+
+        [[nodiscard]] constexpr std::size_t index() const noexcept
+        {
+            return _storage.index();
+        }
+
+        [[nodiscard]] constexpr bool valueless_by_exception() const noexcept
+        {
+            return _storage.valueless();
+        }
+
+        template<std::size_t I, typename... Args>
+        requires (I < sizeof... (Ts)) && std::is_constructible_v<std::tuple_element_t<I, std::tuple<Ts ...>>, Args ...>
+        constexpr decltype(auto) emplace(Args &&... args)
+        {
+            _storage.template emplace<I>(std::forward<Args>(args) ...);
+            return unchecked_get<I>();
+        }
+
+        template<typename T, typename... Args>
+        requires detail::is_unique_alternative<T, Ts ...> && std::is_constructible_v<T, Args ...>
+        constexpr decltype(auto) emplace(Args &&... args)
+        {
+            return emplace<detail::alternative_index<T, Ts ...>>(std::forward<Args>(args) ...);
+        }
+
+        // Accesses an alternative without checking the index, which must be equal to I
+        template<std::size_t I>
+        [[nodiscard]] constexpr decltype(auto) unchecked_get() & noexcept
+        {
+            return _storage.template get<I>();
+        }
+
+        template<std::size_t I>
+        [[nodiscard]] constexpr decltype(auto) unchecked_get() const & noexcept
+        {
+            return _storage.template get<I>();
+        }
+
+        template<std::size_t I>
+        [[nodiscard]] constexpr decltype(auto) unchecked_get() && noexcept
+        {
+            if constexpr (is_packed)
+                return _storage.template get<I>();
+            else
+                return std::move(_storage).template get<I>();
+        }
+
+        template<std::size_t I>
+        [[nodiscard]] constexpr decltype(auto) unchecked_get() const && noexcept
+        {
+            if constexpr (is_packed)
+                return _storage.template get<I>();
+            else
+                return std::move(_storage).template get<I>();
+        }
+
+        [[nodiscard]] friend constexpr bool operator==(variant const &lhs, variant const &rhs)
+        {
+            if (lhs.index() != rhs.index())
+                return false;
+            if (lhs.valueless_by_exception())
+                return true;
+            return detail::visit_index<bool, sizeof... (Ts)>(lhs.index(), [&]<std::size_t I>() {
+                return lhs.template unchecked_get<I>() == rhs.template unchecked_get<I>();
+            });
+        }
+    };
+
+    template<typename T, typename... Ts>
+    [[nodiscard]] constexpr bool holds_alternative(variant<Ts ...> const &v) noexcept
+    {
+        return v.index() == detail::alternative_index<T, Ts ...>;
+    }
+
+    /**
+     * Accesses an alternative of a variant, throwing std::bad_variant_access if it is not the active one.
+     * Packed variants return the alternative by value.
+     */
+    template<std::size_t I, typename... Ts>
+    [[nodiscard]] constexpr decltype(auto) get(variant<Ts ...> &v)
+    {
+        if (v.index() != I)
+            throw std::bad_variant_access{};
+        return v.template unchecked_get<I>();
+    }
+
+    template<std::size_t I, typename... Ts>
+    [[nodiscard]] constexpr decltype(auto) get(variant<Ts ...> const &v)
+    {
+        if (v.index() != I)
+            throw std::bad_variant_access{};
+        return v.template unchecked_get<I>();
+    }
+
+    template<std::size_t I, typename... Ts>
+    [[nodiscard]] constexpr decltype(auto) get(variant<Ts ...> &&v)
+    {
+        if (v.index() != I)
+            throw std::bad_variant_access{};
+        return std::move(v).template unchecked_get<I>();
+    }
+
+    template<std::size_t I, typename... Ts>
+    [[nodiscard]] constexpr decltype(auto) get(variant<Ts ...> const &&v)
+    {
+        if (v.index() != I)
+            throw std::bad_variant_access{};
+        return std::move(v).template unchecked_get<I>();
+    }
+
+    template<typename T, typename... Ts>
+    requires detail::is_unique_alternative<T, Ts ...>
+    [[nodiscard]] constexpr decltype(auto) get(variant<Ts ...> &v)
+    {
+        return get<detail::alternative_index<T, Ts ...>>(v);
+    }
+
+    template<typename T, typename... Ts>
+    requires detail::is_unique_alternative<T, Ts ...>
+    [[nodiscard]] constexpr decltype(auto) get(variant<Ts ...> const &v)
+    {
+        return get<detail::alternative_index<T, Ts ...>>(v);
+    }
+
+    template<typename T, typename... Ts>
+    requires detail::is_unique_alternative<T, Ts ...>
+    [[nodiscard]] constexpr decltype(auto) get(variant<Ts ...> &&v)
+    {
+        return get<detail::alternative_index<T, Ts ...>>(std::move(v));
+    }
+
+    template<typename T, typename... Ts>
+    requires detail::is_unique_alternative<T, Ts ...>
+    [[nodiscard]] constexpr decltype(auto) get(variant<Ts ...> const &&v)
+    {
+        return get<detail::alternative_index<T, Ts ...>>(std::move(v));
+    }
+}
+
+template<typename... Ts>
+struct std::variant_size<fun::variant<Ts ...>> : std::integral_constant<std::size_t, sizeof... (Ts)> {};
+
+template<std::size_t I, typename... Ts>
+struct std::variant_alternative<I, fun::variant<Ts ...>> : std::tuple_element<I, std::tuple<Ts ...>> {};
+#endif //FUN_VARIANT_HPP
@@ -0,0 +1,29 @@
+# Checks that a function in an assembly file refers to a symbol, or does not refer to it
+# Usage: cmake -DASM=<file> -DFUNCTION=<name> -DPATTERN=<regex> -DEXPECTED=<ON|OFF> -P check_codegen.cmake
+file(STRINGS ${ASM} lines)
+
+set(inside OFF)
+set(body "")
+foreach (line IN LISTS lines)
+    if (line MATCHES "^_?${FUNCTION}:")
+        set(inside ON)
+    elseif (inside AND line MATCHES "\\.cfi_endproc|\\.size|^[A-Za-z_][A-Za-z0-9_.$]*:")
+        break()
+    elseif (inside)
+        string(APPEND body "${line}\n")
+    endif()
+endforeach()
+
+if (body STREQUAL "")
+    message(FATAL_ERROR "function ${FUNCTION} not found in ${ASM}")
+endif()
+
+if (body MATCHES "${PATTERN}")
+    set(found ON)
+else()
+    set(found OFF)
+endif()
+
+if (NOT found STREQUAL EXPECTED)
+    message(FATAL_ERROR "expected match of '${PATTERN}' in ${FUNCTION} to be ${EXPECTED}, body:\n${body}")
+endif()
@@ -0,0 +1,30 @@
+// Compiled to assembly by the codegen test, which checks the bodies of the functions below
+#include <fun/member_pointer.hpp>
+
+class vault
+{
+    long _id = 0;
+    long _password = 0;
+};
+
+struct password_tag {};
+
+struct password_accessor
+{
+    static inline long vault::*ptr = nullptr;
+};
+
+template struct fun::enable_access<&vault::_password, password_tag>;
+template struct fun::enable_access<&vault::_password, password_accessor>;
+
+// Must compile to a load at a fixed offset, without loading any global such as the accessor
+extern "C" long read_constant(vault const &v) noexcept
+{
+    return v.*fun::accessed_ptr<password_tag>;
+}
+
+// Loads the mutable pointer first, which shows that the same pattern matches an access that is not folded
+extern "C" long read_mutable(vault const &v) noexcept
+{
+    return v.*password_accessor::ptr;
+}
@@ -12,5 +12,90 @@ namespace fun::tests
     static_assert(sum_10_uncurried(1, 2, 3, 4, 5, 6, 7, 8, 9, 10) == expected);
 
     static_assert(std::is_invocable_v<decltype(sum_10_curried), int>);
-    static_assert(std::is_invocable_v<decltype(sum_10_curried), int, int> == false);
-}
\ No newline at end of file
+    static_assert(std::is_invocable_v<decltype(sum_10_curried), int, int>);
+    static_assert(std::is_invocable_v<decltype(sum_10_curried)> == false);
+
+    // Any number of arguments can be passed at each step
+    static_assert(sum_10_curried(1, 2)(3, 4, 5)(6)(7, 8, 9, 10) == expected);
+    static_assert(sum_10_curried(1, 2, 3, 4, 5, 6, 7, 8, 9, 10) == expected);
+    static_assert(uncurry(curry([](int x) { return x; }))(1) == 1);
+
+    // Tracks how many times an object and its predecessors were copied or moved
+    struct counted
+    {
+        int copies = 0;
+        int moves = 0;
+
+        constexpr counted() noexcept = default;
+        constexpr counted(counted const &other) noexcept : copies{other.copies + 1}, moves{other.moves} {}
+        constexpr counted(counted &&other) noexcept : copies{other.copies}, moves{other.moves + 1} {}
+    };
+
+    inline constexpr auto first_of_3 = [](counted const &x, counted const &, counted const &) { return x; };
+    inline constexpr auto first_of_3_curried = curry(first_of_3);
+
+    // Temporary closures move their state forward at each step: stored into the first closure,
+    // moved into the second one and copied once into the return value
+    static_assert(first_of_3_curried(counted{})(counted{})(counted{}).copies == 1);
+    static_assert(first_of_3_curried(counted{})(counted{})(counted{}).moves == 2);
+
+    // Closures kept as lvalues must copy their state, since they can be invoked again
+    static_assert([] {
+        auto const step_1 = first_of_3_curried(counted{});
+        auto const step_2 = step_1(counted{});
+        return step_2(counted{}).copies;
+    }() == 2);
+    static_assert([] {
+        auto const step_1 = first_of_3_curried(counted{});
+        auto const step_2 = step_1(counted{});
+        return step_2(counted{}).moves;
+    }() == 1);
+
+    struct move_only
+    {
+        int value = 0;
+
+        constexpr explicit move_only(int v) noexcept : value{v} {}
+        constexpr move_only(move_only const &) = delete;
+        constexpr move_only(move_only &&) noexcept = default;
+    };
+
+    inline constexpr auto sum_move_only = curry([](move_only x, move_only y, move_only z) {
+        return x.value + y.value + z.value;
+    });
+
+    static_assert(sum_move_only(move_only{1})(move_only{2})(move_only{3}) == 6);
+    static_assert(std::is_invocable_v<decltype(sum_move_only(move_only{1})) &&, move_only>);
+
+    inline constexpr auto sum_3 = [](int x, int y, int z) noexcept { return x + y + z; };
+    inline constexpr auto sum_3_curried = curry(sum_3);
+
+    using sum_3_type = std::remove_const_t<decltype(sum_3)>;
+
+    // Partial applications of callables with a known arity are stored flat, without the empty callable
+    static_assert(std::is_same_v<decltype(sum_3_curried(1)), curried<sum_3_type, std::tuple<int>>>);
+    static_assert(std::is_same_v<decltype(sum_3_curried(1)(2)), curried<sum_3_type, std::tuple<int, int>>>);
+    static_assert(sizeof(sum_3_curried) == 1);
+    static_assert(sizeof(sum_3_curried(1)) == sizeof(int));
+    static_assert(sizeof(sum_3_curried(1)(2)) == 2 * sizeof(int));
+    static_assert(sizeof(curry(+first_of_3)(counted{})) == sizeof(+first_of_3) + sizeof(counted));
+    static_assert(sum_3_curried(1)(2)(3) == 6);
+    static_assert(std::is_nothrow_invocable_v<decltype(sum_3_curried(1)(2)), int>);
+
+    static_assert(sum_3_curried(1, 2)(3) == 6);
+    static_assert(sum_3_curried(1)(2, 3) == 6);
+    static_assert(std::is_same_v<decltype(sum_3_curried(1, 2)), curried<sum_3_type, std::tuple<int, int>>>);
+
+    // Arguments left over after invoking the function are passed to its result
+    inline constexpr auto make_adder = curry([](int x) { return curry([x](int y, int z) { return x + y + z; }); });
+
+    static_assert(make_adder(1, 2, 3) == 6);
+    static_assert(make_adder(1, 2)(3) == 6);
+    static_assert(uncurry(make_adder)(1, 2, 3) == 6);
+
+    // Functions that do not return curried objects are still uncurried one argument at a time
+    inline constexpr auto nested = [](int x) { return [x](int y) { return x * y; }; };
+
+    static_assert(uncurry(nested)(2, 3) == 6);
+}
+
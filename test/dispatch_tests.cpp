@@ -0,0 +1,49 @@
+#include <fun.hpp>
+
+namespace fun::tests
+{
+    inline constexpr auto identity = []<std::intmax_t I>(tag<I>) { return I; };
+    inline constexpr auto sum = []<std::intmax_t I, std::intmax_t J>(tag<I>, tag<J>) { return I + J; };
+
+    inline constexpr auto opcodes = overload(
+        [](tag<1>) { return 10; },
+        [](tag<2>) { return 20; },
+        [](tag<7>) { return 70; }
+    );
+
+    inline constexpr auto negative = nullsink<1>([] { return -1; });
+    inline constexpr auto negative_pair = nullsink<2>([] { return -1; });
+
+    // Single values
+    static_assert(dispatch<0, 9>(0, identity) == 0);
+    static_assert(dispatch<0, 9>(9, identity) == 9);
+    static_assert(dispatch<-5, 5>(-3, identity) == -3);
+    static_assert(dispatch<0, 99>(57, identity) == 57);
+    static_assert(dispatch<0, 9>(3u, identity) == 3);
+    static_assert(dispatch<0, 9>('\3', identity) == 3);
+
+    // Out of range values and values without a matching signature go to the fallback
+    static_assert(dispatch<0, 9>(10, identity, negative) == -1);
+    static_assert(dispatch<0, 9>(-1, identity, negative) == -1);
+    static_assert(dispatch<0, 9>(~0u, identity, negative) == -1);
+    static_assert(dispatch<0, 9>(7, opcodes, negative) == 70);
+    static_assert(dispatch<0, 9>(3, opcodes, negative) == -1);
+    static_assert(dispatch<0, 9>(3, [](auto) { return 1; }) == 1);
+
+    // Multiple values are dispatched through a single jump
+    static_assert(dispatch<0, 9>(3, 4, sum) == 7);
+    static_assert(dispatch<0, 9>(9, 9, sum) == 18);
+    static_assert(dispatch<0, 9>(9, 10, sum, negative_pair) == -1);
+    static_assert(dispatch<0, 3>(1, 2, 3, [](auto x, auto y, auto z) { return x * 100 + y * 10 + z; }) == 123);
+
+    // Curried functions receive all tags at once
+    static_assert(dispatch<0, 9>(3, 4, curry(sum)) == 7);
+    static_assert(dispatch<0, 9>(3, 4, curry(overload(
+        [](tag<3>, tag<4>) { return 34; },
+        negative_pair
+    ))) == 34);
+
+    static_assert(std::is_same_v<decltype(dispatch<0, 9>(1, identity)), std::intmax_t>);
+    static_assert(std::is_same_v<decltype(dispatch<0, 9>(1, opcodes)), int>);
+    static_assert(std::is_void_v<decltype(dispatch<0, 9>(1, noop))>);
+}
@@ -0,0 +1,81 @@
+#include <string>
+#include <fun.hpp>
+#include "tests.hpp"
+
+namespace fun::tests
+{
+    struct connected { int id; };
+    struct received { std::string text; };
+    struct closed {};
+
+    // Messages only refer to their objects, and know their type without any dispatcher
+    static_assert([] {
+        connected const event{1};
+        message const m = event;
+        return m.holds<connected>() && !m.holds<closed>() && m.data() == &event;
+    }());
+
+    static_assert(std::is_trivially_copyable_v<message>);
+    static_assert(sizeof(message) == 2 * sizeof(void *));
+
+    inline constexpr auto on_connected = [](connected const &e) { return e.id; };
+    inline constexpr auto on_received = [](received e) { return static_cast<int>(e.text.size()); };
+    inline constexpr auto on_other = [](message const &) { return -1; };
+
+    // Handlers are keyed by the type of their parameter, whether it is taken by value or by const reference
+    using typed = dispatcher<decltype(on_connected), decltype(on_received), decltype(on_other)>;
+    static_assert(std::is_same_v<typed::result_type, int>);
+    static_assert(typed::handles<connected> && typed::handles<received const &>);
+    static_assert(!typed::handles<closed> && !typed::handles<message> && !typed::handles<void>);
+    static_assert(std::is_invocable_r_v<int, typed const &, message const &>);
+    static_assert(std::is_invocable_r_v<int, typed const &, closed>);
+
+    // Function pointers are handlers as well, and without a fallback unhandled messages are discarded
+    void on_closed(closed);
+    using pointers = decltype(dispatcher{&on_closed});
+    static_assert(std::is_same_v<pointers, dispatcher<void (*)(closed)>>);
+    static_assert(std::is_same_v<pointers::result_type, void>);
+    static_assert(pointers::handles<closed> && !pointers::handles<connected>);
+
+    // Generic callables, such as null sinks, are used as the fallback
+    using generic = decltype(dispatcher{on_connected, nullsink<1>([] { return 0; })});
+    static_assert(std::is_same_v<generic::result_type, int>);
+    static_assert(std::is_invocable_r_v<int, generic const &, received>);
+
+    void dispatcher_tests()
+    {
+        int fallbacks = 0;
+        dispatcher const events{
+            on_connected,
+            on_received,
+            [&](message const &m) { ++fallbacks; return m.holds<closed>() ? -1 : -2; }
+        };
+        check(events(connected{7}) == 7 && events(received{"abc"}) == 3, "dispatcher invokes the handler of the type");
+        check(events(closed{}) == -1 && events(42) == -2 && fallbacks == 2, "dispatcher passes unhandled types to the fallback");
+
+        // Both dispatchers register connected, so their ids are interleaved with each other's types
+        int closes = 0;
+        dispatcher const other{
+            [&](closed) { ++closes; return 0; },
+            [](connected const &e) { return -e.id; },
+            nullsink<1>([] { return 100; })
+        };
+        check(other(closed{}) == 0 && closes == 1, "dispatcher handles types registered by another dispatcher");
+        check(other(connected{7}) == -7 && events(connected{7}) == 7, "dispatchers sharing a type keep their own handlers");
+        check(other(received{"abc"}) == 100 && events(closed{}) == -1, "dispatchers pass each other's types to their fallbacks");
+
+        // Messages keep referring to their objects, so they can be dispatched more than once
+        received const event{"hello"};
+        message const m = event;
+        check(events(m) == 5 && other(m) == 100, "dispatcher invokes handlers through type-erased messages");
+
+        int connections = 0;
+        dispatcher const discarding{[&](connected const &) { ++connections; }};
+        discarding(connected{1});
+        discarding(closed{});
+        discarding(received{"ignored"});
+        check(connections == 1, "dispatcher without a fallback discards unhandled messages");
+    }
+
+    runtime_test const dispatcher_runtime{dispatcher_tests};
+}
@@ -0,0 +1,68 @@
+#include <fun.hpp>
+#include "tests.hpp"
+
+namespace fun::tests
+{
+    using unary_ref = function_ref<int(int)>;
+
+    inline constexpr auto increment = [](int x) { return x + 1; };
+    inline constexpr auto curried_sum = curry([](int x, int y) { return x + y; });
+    inline constexpr auto overloaded = overload([](int x) { return x; }, [](double) { return 0; });
+
+    // Binding an object only takes its address, which can be done in constant expressions
+    inline constexpr unary_ref increment_ref = increment;
+    inline constexpr unary_ref overloaded_ref = overloaded;
+
+    static_assert(sizeof(unary_ref) == 2 * sizeof(void *));
+    static_assert(std::is_trivially_copyable_v<unary_ref>);
+    static_assert(std::is_trivially_copyable_v<function_ref<void()>>);
+    static_assert(std::is_nothrow_copy_constructible_v<unary_ref>);
+    static_assert(std::is_default_constructible_v<unary_ref> == false);
+
+    static_assert(std::is_constructible_v<unary_ref, int (*)(int)>);
+    static_assert(std::is_constructible_v<unary_ref, int (&)(int)>);
+    static_assert(std::is_constructible_v<unary_ref, decltype(increment) &>);
+    static_assert(std::is_constructible_v<unary_ref, decltype(curried_sum(1)) &>);
+    static_assert(std::is_constructible_v<unary_ref, decltype(overloaded) &>);
+    static_assert(std::is_constructible_v<unary_ref, function<int(int)> &>);
+    static_assert(std::is_constructible_v<unary_ref, inplace_function<int(int)> &>);
+    static_assert(std::is_constructible_v<function_ref<void(int)>, decltype(increment) &>);
+    static_assert(std::is_constructible_v<unary_ref, decltype(curried_sum) &> == false);
+    static_assert(std::is_constructible_v<unary_ref, int (*)(int, int)> == false);
+
+    static_assert(std::is_same_v<decltype(function_ref{+increment}), unary_ref>);
+
+    // Empty callables and exact function pointers can be invoked in constant expressions
+    constexpr int twice(int x) { return 2 * x; }
+    inline constexpr unary_ref twice_ref = twice;
+
+    static_assert(increment_ref(1) == 2);
+    static_assert(overloaded_ref(7) == 7);
+    static_assert(twice_ref(21) == 42);
+    static_assert([] {
+        int total = 0;
+        auto const increment_in_place = [](int &x) { ++x; };
+        function_ref<void(int &)> const add_one = increment_in_place;
+        add_one(total);
+        add_one(total);
+        return total == 2;
+    }());
+
+    long widen(long x)
+    {
+        return x * 1000;
+    }
+
+    void function_ref_tests()
+    {
+        int calls = 0;
+        auto counter = [&](int x) { calls += x; return calls; };
+        unary_ref const counter_ref = counter;
+        check(counter_ref(2) == 2 && counter_ref(3) == 5 && calls == 5, "function_ref invokes stateful callables");
+
+        function_ref<long(int)> const widen_ref = &widen;
+        check(widen_ref(7) == 7000, "function_ref invokes function pointers of compatible signatures");
+    }
+
+    runtime_test const function_ref_runtime{function_ref_tests};
+}
@@ -0,0 +1,30 @@
+#include <fun.hpp>
+
+namespace fun::tests
+{
+    struct named {};
+
+    static_assert(detail::type_name<int>() == "int");
+    static_assert(detail::type_name<named>().ends_with("fun::tests::named"));
+    static_assert(function<int(double)>::fptr_name().starts_with("int"));
+    static_assert(function<int(double)>::class_name().find("fun::function<") != std::string_view::npos);
+
+// The exact spelling of type names depends on the compiler
+#if defined(__clang__) || defined(__GNUC__)
+    static_assert(function<int(double)>::fptr_name() == "int (*)(double)");
+    static_assert(function<void()>::fptr_name() == "void (*)()");
+#endif
+
+    // Compilers spell function types differently, so the class name is compared with the name of its argument
+    template<typename Signature>
+    constexpr bool names_signature(std::string_view name) noexcept
+    {
+        constexpr std::string_view prefix = "fun::function<";
+        std::size_t const start = name.find(prefix);
+        return start != std::string_view::npos && name.ends_with(">")
+            && name.substr(start + prefix.size(), name.size() - start - prefix.size() - 1) == detail::type_name<Signature>();
+    }
+
+    static_assert(names_signature<int(double)>(function<int(double)>::class_name()));
+    static_assert(names_signature<bool(named)>(predicate<named>::class_name()));
+}
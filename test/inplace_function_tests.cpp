@@ -0,0 +1,102 @@
+#include <functional>
+#include <memory>
+#include <utility>
+#include <fun.hpp>
+#include "tests.hpp"
+
+namespace fun::tests
+{
+    using unary = inplace_function<int(int)>;
+
+    inline constexpr auto stateful = [x = 1, y = 2](int z) { return x + y + z; };
+    inline auto const move_only = [p = std::unique_ptr<int>{}](int) { return p ? 1 : 0; };
+    inline auto const curried = curry([](int x, int y) { return x + y; });
+
+    static_assert(sizeof(unary) == inplace_capacity + alignof(std::max_align_t));
+    static_assert(sizeof(inplace_function<void(), 8, 8>) == 3 * sizeof(void *));
+
+    static_assert(std::is_constructible_v<unary, int (*)(int)>);
+    static_assert(std::is_constructible_v<unary, decltype(stateful)>);
+    static_assert(std::is_constructible_v<unary, decltype(move_only) &&>);
+    static_assert(std::is_constructible_v<unary, decltype(curried(1))>);
+    static_assert(std::is_constructible_v<unary, decltype(overload([](int) { return 0; }, [](double) { return 1; }))>);
+    static_assert(std::is_constructible_v<unary, function<int(int)>>);
+    static_assert(std::is_constructible_v<unary, std::nullptr_t>);
+    static_assert(std::is_constructible_v<unary, int (*)(int, int)> == false);
+    static_assert(std::is_constructible_v<unary, decltype(stateful) &> == true);
+
+    // Callables that do not fit or may throw when moved fail a static_assert when they are stored
+    struct large { char data[inplace_capacity + 1]; int operator()(int) const; };
+    struct alignas(2 * alignof(std::max_align_t)) overaligned { int operator()(int) const; };
+    struct throwing_move { throwing_move(throwing_move &&) noexcept(false); int operator()(int) const; };
+
+    static_assert(unary::can_store<decltype(stateful)> && unary::can_store<int (*)(int)>);
+    static_assert(unary::can_store<large> == false);
+    static_assert(inplace_function<int(int), sizeof(large)>::can_store<large>);
+    static_assert(unary::can_store<overaligned> == false);
+    static_assert(unary::can_store<throwing_move> == false);
+
+    static_assert(std::is_nothrow_move_constructible_v<unary>);
+    static_assert(std::is_nothrow_move_assignable_v<unary>);
+    static_assert(std::is_copy_constructible_v<unary> == false);
+    static_assert(std::is_copy_assignable_v<unary> == false);
+
+    static_assert(std::is_same_v<decltype(inplace_function{+[](int) { return 0; }}), unary>);
+    static_assert(std::is_same_v<inplace::predicate<int>, inplace_function<bool(int)>>);
+    static_assert(std::is_same_v<inplace::comparator<int, int>, inplace_function<bool(int, int)>>);
+    static_assert(std::is_same_v<inplace::transform<int>, unary>);
+    static_assert(std::is_same_v<inplace::action<>, inplace_function<void()>>);
+
+    // Counts the destructions of live objects, so that moved-from copies are not counted
+    struct tracker
+    {
+        int *destroyed;
+
+        explicit tracker(int &count) noexcept : destroyed{&count} {}
+        tracker(tracker &&other) noexcept : destroyed{std::exchange(other.destroyed, nullptr)} {}
+
+        ~tracker()
+        {
+            if (destroyed)
+                ++*destroyed;
+        }
+    };
+
+    void inplace_function_tests()
+    {
+        int destroyed = 0;
+        {
+            unary f = [total = std::make_unique<int>(0), t = tracker{destroyed}](int x) {
+                return *total += x;
+            };
+            check(f(2) == 2 && f(3) == 5, "inplace_function invokes a stateful move-only closure");
+
+            unary g = std::move(f);
+            check(!f && g && g(1) == 6 && destroyed == 0, "inplace_function move-constructs the stored closure");
+
+            unary h = [](int x) { return -x; };
+            h = std::move(g);
+            check(!g && h(4) == 10 && destroyed == 0, "inplace_function move-assigns the stored closure");
+
+            bool thrown = false;
+            try
+            {
+                static_cast<void>(g(1));
+            }
+            catch (std::bad_function_call const &)
+            {
+                thrown = true;
+            }
+            check(thrown, "moved-from inplace_function throws on invocation");
+
+            h = nullptr;
+            check(!h && destroyed == 1, "inplace_function destroys the stored closure when reset");
+
+            unary k = [t = tracker{destroyed}](int x) { return x; };
+            check(k(7) == 7, "inplace_function invokes a closure with a non-trivial destructor");
+        }
+        check(destroyed == 2, "inplace_function destroys the stored closure on destruction");
+    }
+
+    runtime_test const inplace_function_runtime{inplace_function_tests};
+}
@@ -0,0 +1,73 @@
+#include <fun.hpp>
+
+namespace fun::tests
+{
+    struct padded
+    {
+        char tag;
+        double value;
+        short count;
+        int id;
+    };
+
+    struct packed
+    {
+        double value;
+        int id;
+        short count;
+        char tag;
+    };
+
+    class hidden
+    {
+        bool _flag = false;
+        long _total = 0;
+        bool _other = false;
+    };
+
+    using padded_layout = struct_layout<&padded::tag, &padded::value, &padded::count, &padded::id>;
+    using packed_layout = struct_layout<&packed::value, &packed::id, &packed::count, &packed::tag>;
+
+    static_assert(padded_layout::complete);
+    static_assert(padded_layout::value.size == sizeof(padded));
+    static_assert(padded_layout::value.fields[1].offset == alignof(double));
+    static_assert(padded_layout::value.fields[1].padding == alignof(double) - 1);
+    static_assert(padded_layout::value.fields[2].type == detail::type_name<short>());
+    static_assert(padded_layout::value.wasted_bytes == sizeof(padded) - 15);
+    static_assert(padded_layout::value.can_shrink());
+    static_assert(padded_layout::value.optimal_size == sizeof(packed));
+    static_assert(padded_layout::value.optimal_order == std::array<std::size_t, 4>{1, 3, 2, 0});
+
+    static_assert(packed_layout::complete);
+    static_assert(packed_layout::value.can_shrink() == false);
+    static_assert(packed_layout::value.tail_padding == sizeof(packed) - 15);
+    static_assert(packed_layout::value.optimal_order == std::array<std::size_t, 4>{0, 1, 2, 3});
+
+    struct tail
+    {
+        double value;
+        int id;
+        int count;
+    };
+
+    // Missing members are detected by the size of the class, or by the number of fields of aggregates
+    static_assert(struct_layout<&padded::tag, &padded::value>::complete == false);
+    static_assert(struct_layout<&tail::value, &tail::id, &tail::count>::complete);
+    static_assert(struct_layout<&tail::value, &tail::id>::predicted_size == sizeof(tail));
+    static_assert(struct_layout<&tail::value, &tail::id>::complete == false);
+
+    // Members must be listed in declaration order, even if the predicted size matches
+    static_assert(struct_layout<&tail::value, &tail::count, &tail::id>::predicted_size == sizeof(tail));
+    static_assert(struct_layout<&tail::value, &tail::count, &tail::id>::complete == false);
+}
+
+// Private members can be audited through an explicit instantiation
+template struct fun::audit_layout<
+    fun::member_pointers<&fun::tests::hidden::_flag, &fun::tests::hidden::_total, &fun::tests::hidden::_other>,
+    2 * alignof(long)
+>;
+
+template struct fun::audit_layout<
+    fun::member_pointers<&fun::tests::packed::value, &fun::tests::packed::id, &fun::tests::packed::count, &fun::tests::packed::tag>,
+    1
+>;
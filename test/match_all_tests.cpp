@@ -0,0 +1,134 @@
+#include <stdexcept>
+#include <string_view>
+#include <variant>
+#include <vector>
+#include <fun.hpp>
+#include "tests.hpp"
+
+namespace fun::tests
+{
+    using shape = std::variant<int, double, std::string_view>;
+
+    constexpr std::vector<shape> shapes()
+    {
+        return {1, 2.5, "three", 4, "five", 6.5};
+    }
+
+    inline constexpr auto describe = overload(
+        [](int x) { return x; },
+        [](double x) { return static_cast<int>(10 * x); },
+        [](std::string_view s) { return -static_cast<int>(s.size()); }
+    );
+
+    // Results are grouped by alternative, in the order of the elements within each alternative
+    static_assert(match_all(shapes(), describe) == std::vector{1, 4, 25, 65, -5, -4});
+
+    static_assert(match_all<match_mode::ordered>(shapes(), describe) == std::vector{1, 25, -5, 4, -4, 65});
+
+    // Separate matchers work as well, including generic ones
+    static_assert(match_all<match_mode::ordered>(
+        shapes(),
+        [](int) { return 'i'; },
+        [](auto const &) { return '?'; }
+    ) == std::vector{'i', '?', '?', 'i', '?', '?'});
+
+    static_assert([] {
+        std::vector<int> calls;
+        auto const values = shapes();
+        match_all(
+            values,
+            [&](int x) { calls.push_back(x); },
+            [&](double x) { calls.push_back(static_cast<int>(x)); },
+            [&](std::string_view s) { calls.push_back(static_cast<int>(s.size())); }
+        );
+        return calls == std::vector{1, 4, 2, 6, 5, 4};
+    }());
+
+    // Matchers receive references to the elements, so they can modify them
+    static_assert([] {
+        auto values = shapes();
+        match_all(values, [](int &x) { x *= 10; }, [](auto &) {});
+        return std::get<int>(values[0]) == 10 && std::get<int>(values[3]) == 40;
+    }());
+
+    static_assert(match_all(std::vector<shape>{}, describe).empty());
+    static_assert(match_mode::ordered == (match_mode::unordered | match_mode::ordered));
+
+    // Not trivially copyable, so that the variant cannot construct it aside and stays valueless on failure
+    struct throws_on_construction
+    {
+        throws_on_construction()
+        {
+            throw std::runtime_error{"construction failed"};
+        }
+
+        throws_on_construction(throws_on_construction const &) {}
+    };
+
+    void match_all_tests()
+    {
+        // Several chunks of each alternative are matched, by more than one thread if possible
+        using element = std::variant<int, double>;
+        std::vector<element> elements;
+        for (int i = 0; i < 3 * static_cast<int>(detail::match_chunk_size); ++i)
+            elements.push_back(i % 3 == 0 ? element{i} : element{i * 0.5});
+
+        auto const truncate = overload([](int x) { return x; }, [](double x) { return static_cast<int>(-x); });
+        auto const ordered = match_all<match_mode::ordered>(elements, truncate);
+        auto const parallel = match_all<match_mode::ordered | match_mode::parallel>(elements, truncate);
+        check(parallel == ordered, "parallel ordered matching gives the same results as sequential matching");
+        check(ordered[3] == 3 && ordered[4] == -2 && ordered.size() == elements.size(), "ordered matching keeps positions");
+
+        auto const grouped = match_all<match_mode::parallel>(elements, truncate);
+        check(grouped.front() == 0 && grouped[1] == 3 && grouped.back() == ordered.back(), "parallel matching groups by alternative");
+
+        auto const throwing = overload(
+            [](int x) { return x == 9000 ? throw std::runtime_error{"matcher failed"} : x; },
+            [](double) { return 0; }
+        );
+        bool thrown = false;
+        try
+        {
+            static_cast<void>(match_all<match_mode::ordered | match_mode::parallel>(elements, throwing));
+        }
+        catch (std::runtime_error const &)
+        {
+            thrown = true;
+        }
+        check(thrown, "parallel matching rethrows the exception of a matcher");
+
+        thrown = false;
+        try
+        {
+            static_cast<void>(match_all<match_mode::ordered>(elements, throwing));
+        }
+        catch (std::runtime_error const &)
+        {
+            thrown = true;
+        }
+        check(thrown, "ordered matching propagates the exception of a matcher");
+
+        // Valueless elements are found before any matcher is invoked
+        std::vector<std::variant<int, throws_on_construction>> valueless(2);
+        try
+        {
+            valueless[1].emplace<throws_on_construction>();
+        }
+        catch (std::runtime_error const &)
+        {
+        }
+        int calls = 0;
+        thrown = false;
+        try
+        {
+            match_all(valueless, [&](auto const &) { ++calls; });
+        }
+        catch (std::bad_variant_access const &)
+        {
+            thrown = true;
+        }
+        check(valueless[1].valueless_by_exception() && thrown && calls == 0, "matching a valueless element throws");
+    }
+
+    runtime_test const match_all_runtime{match_all_tests};
+}
@@ -0,0 +1,110 @@
+#include <fun.hpp>
+
+namespace fun::tests
+{
+    class vault
+    {
+        int _id = 7;
+        long _password = 1234;
+
+    public:
+        constexpr vault() noexcept = default;
+
+        constexpr explicit vault(long password) noexcept : _password{password} {}
+    };
+
+    struct password_tag {};
+    struct id_tag {};
+
+    struct password_accessor
+    {
+        static inline long vault::*ptr = nullptr;
+    };
+}
+
+template struct fun::enable_access<&fun::tests::vault::_password, fun::tests::password_tag>;
+template struct fun::enable_access<&fun::tests::vault::_id, fun::tests::id_tag>;
+template struct fun::enable_access<&fun::tests::vault::_password, fun::tests::password_accessor>;
+
+namespace fun::tests
+{
+    // The pointer is a constant expression, so accesses through it need no runtime state
+    static_assert(std::is_same_v<decltype(accessed_ptr<password_tag>), long vault::* const>);
+    static_assert(vault{}.*accessed_ptr<password_tag> == 1234);
+    static_assert(vault{99}.*accessed_ptr<password_tag> == 99);
+    static_assert(vault{}.*accessed_ptr<id_tag> == 7);
+
+    // The pointer can even be a template argument
+    using id_constant = std::integral_constant<decltype(accessed_ptr<id_tag>), accessed_ptr<id_tag>>;
+    static_assert(vault{}.*id_constant::value == 7);
+
+    static_assert([] {
+        vault v{};
+        v.*accessed_ptr<password_tag> = 42;
+        return v.*accessed_ptr<password_tag> == 42;
+    }());
+
+    // Accessors with a mutable pointer also get a constant one
+    static_assert(vault{5}.*accessed_ptr<password_accessor> == 5);
+
+    // Usable during constant initialization, unlike pointers assigned during dynamic initialization
+    constinit long const initial_password = vault{}.*accessed_ptr<password_tag>;
+}
+
+namespace fun::tests
+{
+    class point
+    {
+        int _x = 1;
+        int _y = 2;
+        double _weight = 0.5;
+
+    public:
+        constexpr point() noexcept = default;
+    };
+}
+
+template struct fun::member_pointers<
+    &fun::tests::point::_x,
+    &fun::tests::point::_y,
+    &fun::tests::point::_weight
+>::registered;
+
+namespace fun::tests
+{
+    using point_pointers = member_pointers_of<point>;
+
+    static_assert(point_pointers::size == 3);
+    static_assert(std::tuple_size_v<decltype(point_pointers::pointers)> == 3);
+    static_assert(point{}.*std::get<1>(point_pointers::pointers) == 2);
+    static_assert(std::is_same_v<point_pointers::registered::class_type, point>);
+
+    static_assert(point_pointers::apply([](auto x, auto y, auto weight) {
+        point const p{};
+        return p.*x + p.*y + p.*weight;
+    }) == 3.5);
+
+    static_assert([] {
+        point const p{};
+        double sum = 0;
+        point_pointers::for_each([&](auto ptr) { sum += p.*ptr; });
+        return sum;
+    }() == 3.5);
+
+    static_assert([] {
+        point const p{};
+        int ints = 0;
+        double doubles = 0;
+        point_pointers::match_each(
+            [&](int point::*ptr) { ints += p.*ptr; },
+            [&](double point::*ptr) { doubles += p.*ptr; }
+        );
+        return ints == 3 && doubles == 0.5;
+    }());
+
+    // Pointers that are already accessible do not need an explicit instantiation
+    static_assert(member_pointers<accessed_ptr<id_tag>, accessed_ptr<password_tag>>::apply([](auto id, auto password) {
+        vault const v{};
+        return v.*id + v.*password;
+    }) == 1241);
+}
@@ -0,0 +1,63 @@
+#include <string>
+#include <fun.hpp>
+#include "tests.hpp"
+
+namespace fun::tests
+{
+    inline constexpr auto sum = [](int x, int y) { return x + y; };
+    inline constexpr auto length = [](std::string const &s) { return s.size(); };
+    inline constexpr auto overloaded = overload([](int x) { return x; }, [](double) { return 0; });
+
+    using memoized_sum = decltype(memoize(sum));
+    using memoized_length = decltype(memoize(length));
+    using memoized_overload = decltype(memoize<int(double)>(overloaded));
+
+    // Signatures are deduced from callables with a single call operator
+    static_assert(std::is_same_v<memoized_sum, memoized<int(int, int), std::remove_const_t<decltype(sum)>>>);
+    static_assert(std::is_same_v<memoized_length::key_type, std::tuple<std::string>>);
+    static_assert(std::is_same_v<memoized_length::value_type, std::size_t>);
+    static_assert(std::is_same_v<decltype(memoize(+sum)), memoized<int(int, int), int (*)(int, int)>>);
+
+    // Overload sets are memoized for an explicit signature
+    static_assert(std::is_invocable_r_v<int, memoized_overload const &, double>);
+    static_assert(std::is_invocable_v<memoized_overload const &, std::string> == false);
+
+    // Memoized functions have a single signature, so curry knows their arity
+    static_assert(traits::call_arity_v<memoized_sum> == 2);
+    static_assert(std::is_invocable_r_v<int, decltype(curry(std::declval<memoized_sum>())(1)), int>);
+
+    // Copies share the cache, and stateless callables take no space
+    static_assert(std::is_nothrow_copy_constructible_v<memoized_sum>);
+    static_assert(std::is_nothrow_move_constructible_v<memoized_sum>);
+    static_assert(sizeof(memoized_sum) == sizeof(std::shared_ptr<int>));
+
+    void memoize_tests()
+    {
+        // A single shard makes the eviction order observable
+        int calls = 0;
+        auto const square = memoize<1>([&](int x) { ++calls; return x * x; }, 2);
+        check(square(2) == 4 && square(3) == 9 && square(2) == 4, "memoized function returns cached results");
+        check(square(4) == 16 && square(2) == 4 && calls == 3, "memoized function keeps recently used results");
+        check(square(3) == 9 && calls == 4, "memoized function evicts the least recently used result");
+
+        memoize_stats const stats = square.stats();
+        check(stats.hits == 2 && stats.misses == 4 && stats.size == 2, "memoized function counts hits and misses");
+
+        // Each shard holds its share of the capacity rounded up, which bounds the whole cache
+        auto const identity = memoize([](int x) { return x; }, 20);
+        for (int i = 0; i < 1000; ++i)
+            static_cast<void>(identity(i));
+        check(identity.stats().size <= memoize_shards * 2, "memoized function bounds the size of the cache");
+
+        // Curried copies share the cache of the memoized function
+        auto const cached_sum = memoize(sum);
+        check(cached_sum(1, 2) == 3 && curry(cached_sum)(1)(2) == 3 && cached_sum.stats().hits == 1,
+              "curried memoized function shares the cache");
+
+        auto const cached_overload = memoize<int(double)>(overloaded);
+        check(cached_overload(2.5) == 0 && cached_overload(2.5) == 0 && cached_overload.stats().hits == 1,
+              "memoized overload set uses the selected signature");
+    }
+
+    runtime_test const memoize_runtime{memoize_tests};
+}
@@ -31,4 +31,80 @@ namespace fun::tests
     static_assert(unit(9_t) == 21_t);
     static_assert(std::is_void_v<decltype(unit())>);
     static_assert(std::is_invocable_v<decltype(unit), int> == false);
-}
\ No newline at end of file
+
+    using small_variant = std::variant<int, double, tag<1>>;
+
+    inline constexpr auto kind_of = [](auto &&var) {
+        return match(
+            std::forward<decltype(var)>(var),
+            [](int) { return 0; },
+            [](double) { return 1; },
+            [](auto) { return 2; }
+        );
+    };
+
+    static_assert(kind_of(small_variant{1}) == 0);
+    static_assert(kind_of(small_variant{1.0}) == 1);
+    static_assert(kind_of(small_variant{1_t}) == 2);
+
+    template<std::size_t... Indices>
+    constexpr auto make_large_variant(std::size_t index, std::index_sequence<Indices ...>)
+    {
+        using variant = std::variant<tag<Indices> ...>;
+        variant var{};
+        ((index == Indices ? (var = tag<Indices>{}, true) : false) || ...);
+        return var;
+    }
+
+    // Variants with many alternatives fall back to a table of function pointers
+    inline constexpr auto large_variant_index = [](std::size_t index) {
+        return match(
+            make_large_variant(index, std::make_index_sequence<40>{}),
+            []<std::intmax_t ID>(tag<ID>) { return ID; }
+        );
+    };
+
+    static_assert(large_variant_index(0) == 0);
+    static_assert(large_variant_index(17) == 17);
+    static_assert(large_variant_index(39) == 39);
+
+    inline constexpr auto category_of = overload(
+        [](int &) { return 0; },
+        [](int const &) { return 1; },
+        [](int &&) { return 2; }
+    );
+
+    static_assert([] { std::variant<int> var{}; return match(var, category_of); }() == 0);
+    static_assert([] { std::variant<int> const var{}; return match(var, category_of); }() == 1);
+    static_assert(match(std::variant<int>{}, category_of) == 2);
+
+    using other_variant = std::variant<tag<2>, char>;
+
+    inline constexpr auto pair_kind = overload(
+        [](int, tag<2>) { return 0; },
+        [](int, char) { return 1; },
+        [](double, auto) { return 2; },
+        [](auto, auto) { return 3; }
+    );
+
+    // Multiple variants are matched together through a single flattened table
+    static_assert(match(small_variant{1}, other_variant{2_t}, pair_kind) == 0);
+    static_assert(match(small_variant{1}, other_variant{'a'}, pair_kind) == 1);
+    static_assert(match(small_variant{1.0}, other_variant{'a'}, pair_kind) == 2);
+    static_assert(match(small_variant{1_t}, other_variant{2_t}, pair_kind) == 3);
+    static_assert(match(small_variant{1}, other_variant{'a'}, small_variant{1.0}, [](auto...) { return 4; }) == 4);
+
+    // Classes derived from variants are matched as their base, like std::visit does
+    struct derived_variant : small_variant
+    {
+        using small_variant::small_variant;
+    };
+
+    struct private_variant : private small_variant {};
+
+    static_assert(detail::is_variant_v<derived_variant const &>);
+    static_assert(detail::is_variant_v<private_variant> == false);
+    static_assert(detail::variant_size_v<derived_variant> == 3);
+    static_assert(kind_of(derived_variant{1.0}) == 1);
+    static_assert(match(derived_variant{1_t}, other_variant{'a'}, pair_kind) == 3);
+}
@@ -0,0 +1,78 @@
+#include <array>
+#include <functional>
+#include <iterator>
+#include <vector>
+#include <fun.hpp>
+
+namespace fun::tests
+{
+    inline constexpr std::array<int, 10> digits{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    inline constexpr auto square = [](int x) { return x * x; };
+    inline constexpr auto is_even = [](int x) { return x % 2 == 0; };
+
+    using square_type = std::remove_const_t<decltype(square)>;
+    using is_even_type = std::remove_const_t<decltype(is_even)>;
+
+    // Stages can be composed before they are bound to a range
+    inline constexpr auto even_squares = compose(filter(is_even), map(square));
+
+    static_assert(std::is_same_v<decltype(even_squares), pipeline<0, filter_stage<is_even_type>, map_stage<square_type>> const>);
+    static_assert(std::is_same_v<decltype(map(square) | filter(is_even)), pipeline<0, map_stage<square_type>, filter_stage<is_even_type>>>);
+    static_assert(decltype(even_squares | chunked<4>)::chunk_size == 4);
+    static_assert(decltype(chunked<4> | even_squares | chunked<8>)::chunk_size == 8);
+    static_assert(std::is_same_v<decltype(compose()), pipeline<0>>);
+
+    static_assert((digits | even_squares | fold(0, std::plus<>{})) == 0 + 4 + 16 + 36 + 64);
+    static_assert((digits | map(square) | filter(is_even) | fold(0, std::plus<>{})) == 0 + 4 + 16 + 36 + 64);
+    static_assert((digits | compose() | fold(0, std::plus<>{})) == 45);
+
+    // Chunked pipelines give the same results, including for partial blocks
+    static_assert((digits | chunked<4> | even_squares | fold(0, std::plus<>{})) == 120);
+    static_assert((digits | chunked<1> | even_squares | fold(0, std::plus<>{})) == 120);
+    static_assert((digits | chunked<64> | even_squares | fold(0, std::plus<>{})) == 120);
+    static_assert((digits | chunked<3> | filter([](int) { return false; }) | fold(0, std::plus<>{})) == 0);
+
+    static_assert([] {
+        std::vector<int> out;
+        digits | filter(is_even) | map(square) | into(std::back_inserter(out));
+        return out == std::vector{0, 4, 16, 36, 64};
+    }());
+
+    static_assert([] {
+        std::vector<int> out;
+        digits | even_squares | chunked<4> | into(std::back_inserter(out));
+        return out == std::vector{0, 4, 16, 36, 64};
+    }());
+
+    // Elements are pushed through all stages one at a time, unless the pipeline is chunked
+    static_assert([] {
+        std::vector<int> order;
+        digits | tap([&](int x) { order.push_back(x); }) | filter([](int x) { return x < 2; })
+            | sink([&](int x) { order.push_back(-x - 1); });
+        return order == std::vector{0, -1, 1, -2, 2, 3, 4, 5, 6, 7, 8, 9};
+    }());
+
+    static_assert([] {
+        std::vector<int> order;
+        std::array<int, 3> const values{1, 2, 3};
+        values | chunked<2> | tap([&](int x) { order.push_back(x); }) | sink([&](int x) { order.push_back(-x); });
+        return order == std::vector{1, 2, -1, -2, 3, -3};
+    }());
+
+    // The element type can change between stages
+    static_assert((digits | map([](int x) { return x * 0.5; }) | fold(0.0, std::plus<>{})) == 22.5);
+    static_assert((digits | chunked<4> | map([](int x) { return x * 0.5; }) | fold(0.0, std::plus<>{})) == 22.5);
+
+    // Stages work with the function pointer wrappers
+    constexpr int triple(int x) noexcept { return 3 * x; }
+    constexpr bool is_odd(int x) noexcept { return x % 2 == 1; }
+    static_assert((digits | map(transform<int>{triple}) | filter(predicate<int>{is_odd}) | fold(0, std::plus<>{})) == 75);
+
+    // Ranges that are not contiguous are gathered into blocks
+    static_assert([] {
+        std::vector<int> out;
+        std::views::iota(0, 10) | chunked<4> | even_squares | into(std::back_inserter(out));
+        return out == std::vector{0, 4, 16, 36, 64};
+    }());
+}
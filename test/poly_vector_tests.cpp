@@ -0,0 +1,90 @@
+#include <string_view>
+#include <vector>
+#include <fun.hpp>
+
+namespace fun::tests
+{
+    struct circle { double radius = 0; };
+    struct square { double side = 0; };
+    struct label { std::string_view text; };
+
+    using shapes = poly_vector<circle, square, label>;
+
+    static_assert(shapes::holds<circle> && shapes::holds<label>);
+    static_assert(shapes::holds<int> == false);
+    static_assert(std::is_same_v<decltype(lvalue<shapes>().segment<square>()), std::span<square>>);
+    static_assert(std::is_same_v<decltype(lvalue<shapes const>().segment<square>()), std::span<square const>>);
+
+    // Every stored type must be accepted by the overload set
+    template<typename... Fs>
+    concept visitable = requires (shapes s, Fs... fs) { s.for_each(fs ...); };
+
+    static_assert(visitable<decltype([](auto const &) {})>);
+    static_assert(visitable<decltype([](circle) {}), decltype([](square) {})> == false);
+
+    constexpr shapes make_shapes()
+    {
+        shapes s;
+        s.push_back(circle{1});
+        s.push_back(square{2});
+        s.push_back(label{"a"});
+        s.emplace_back<circle>(3.0);
+        s.push_back(square{4});
+        return s;
+    }
+
+    static_assert(make_shapes().size() == 5);
+    static_assert(make_shapes().size<circle>() == 2);
+    static_assert(make_shapes().size<label>() == 1);
+    static_assert(make_shapes().segment<circle>()[1].radius == 3);
+    static_assert(shapes{}.empty());
+
+    // Elements are visited one type at a time, keeping their order within each type
+    static_assert([] {
+        std::vector<double> visited;
+        make_shapes().for_each(
+            [&](circle const &c) { visited.push_back(c.radius); },
+            [&](square const &s) { visited.push_back(-s.side); },
+            [&](label const &) { visited.push_back(0); }
+        );
+        return visited == std::vector<double>{1, 3, -2, -4, 0};
+    }());
+
+    static_assert([] {
+        auto s = make_shapes();
+        s.for_each(
+            [](circle &c) { c.radius *= 10; },
+            [](auto &) {}
+        );
+        return s.segment<circle>()[0].radius == 10 && s.segment<square>()[0].side == 2;
+    }());
+
+    static_assert([] {
+        auto s = make_shapes();
+        s.erase<circle>(0);
+        s.erase<label>(0);
+        return s.size() == 3 && s.segment<circle>()[0].radius == 3 && s.size<label>() == 0;
+    }());
+
+    static_assert([] {
+        auto s = make_shapes();
+        s.clear();
+        return s.empty();
+    }());
+
+    // Bools are stored a byte at a time, and visited as plain bools
+    using flags = poly_vector<bool, int>;
+    static_assert(std::is_same_v<decltype(lvalue<flags>().segment<bool>()), std::span<boolean>>);
+    static_assert(std::is_same_v<decltype(lvalue<flags>().emplace_back<bool>(true)), bool &>);
+
+    static_assert([] {
+        flags f;
+        f.push_back(true);
+        f.push_back(1);
+        f.emplace_back<bool>(false) = true;
+        f.push_back(false);
+        int count = 0;
+        f.for_each([&](bool &b) { count += b; b = !b; }, [&](int x) { count += 10 * x; });
+        return count == 12 && !f.segment<bool>()[0] && f.segment<bool>()[2];
+    }());
+}
@@ -0,0 +1,132 @@
+#include <cstring>
+#include <string>
+#include <fun.hpp>
+#include "tests.hpp"
+
+namespace fun::tests
+{
+    struct empty {};
+
+    struct point
+    {
+        int x;
+        int y;
+    };
+
+    struct named
+    {
+        point position;
+        std::string name;
+        double weight;
+    };
+
+    struct wide
+    {
+        int a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15;
+        int b0, b1, b2, b3, b4, b5, b6, b7, b8, b9, b10, b11, b12, b13, b14, b15;
+    };
+
+    struct too_wide
+    {
+        wide w;
+        int a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15;
+        int b0, b1, b2, b3, b4, b5, b6, b7, b8, b9, b10, b11, b12, b13, b14, b15;
+    };
+
+    struct with_array
+    {
+        int a[2];
+        int b;
+    };
+
+    struct with_reference
+    {
+        int &r;
+        std::string s;
+    };
+
+    class not_aggregate
+    {
+        int _x = 0;
+    };
+
+    static_assert(field_count<empty> == 0);
+    static_assert(field_count<point> == 2);
+    static_assert(field_count<named> == 3);
+    static_assert(field_count<wide> == max_reflected_fields);
+    static_assert(reflectable<too_wide> == false);
+    static_assert(reflectable<with_array> == false);
+    static_assert(field_count<with_reference> == 2);
+    static_assert(reflectable<not_aggregate> == false);
+    static_assert(reflectable<int> == false);
+
+    static_assert(std::is_same_v<decltype(tie_fields(lvalue<point>())), std::tuple<int &, int &>>);
+    static_assert(std::is_same_v<decltype(tie_fields(lvalue<point const>())), std::tuple<int const &, int const &>>);
+    static_assert(std::is_same_v<decltype(tie_fields(lvalue<empty>())), std::tuple<>>);
+    static_assert([] {
+        named n{{1, 2}, "n", 3.0};
+        return std::get<0>(tie_fields(n)).y == 2 && std::get<1>(tie_fields(n)) == "n";
+    }());
+
+    static_assert([] {
+        wide w{};
+        w.b15 = 7;
+        return std::get<31>(tie_fields(w)) == 7;
+    }());
+
+    static_assert([] {
+        point p{1, 2};
+        std::get<0>(tie_fields(p)) = 10;
+        return p.x == 10;
+    }());
+
+    // Fields are compared in declaration order, nested aggregates included
+    static_assert(fields_equal_to{}(point{1, 2}, point{1, 2}));
+    static_assert(!fields_equal_to{}(point{1, 2}, point{1, 3}));
+    static_assert(fields_equal_to{}(named{{1, 2}, "a", 1.0}, named{{1, 2}, "a", 1.0}));
+    static_assert(fields_compare_three_way{}(point{1, 2}, point{1, 3}) < 0);
+    static_assert(fields_compare_three_way{}(point{2, 0}, point{1, 3}) > 0);
+    static_assert(fields_less{}(point{-1, 5}, point{0, 0}));
+    static_assert(fields_compare_three_way{}(named{{1, 2}, "a", 1.0}, named{{1, 2}, "b", 0.0}) < 0);
+    static_assert(fields_compare_three_way{}(named{{1, 3}, "a", 1.0}, named{{1, 2}, "b", 0.0}) > 0);
+    static_assert(std::is_same_v<decltype(fields_compare_three_way{}(point{}, point{})), std::strong_ordering>);
+    static_assert(std::is_same_v<decltype(fields_compare_three_way{}(named{}, named{})), std::partial_ordering>);
+
+    static_assert(std::has_unique_object_representations_v<point>);
+    static_assert(std::is_nothrow_invocable_r_v<std::size_t, fields_hash, point const &>);
+    static_assert(std::is_invocable_r_v<std::size_t, fields_hash, named const &>);
+    static_assert(std::is_invocable_v<fields_hash, not_aggregate const &> == false);
+
+    struct with_padding
+    {
+        char c;
+        int i;
+    };
+
+    static_assert(!std::has_unique_object_representations_v<with_padding>);
+
+    void reflect_tests()
+    {
+        // Objects without padding take the memcmp and word-wise hash paths
+        point const p{1, 2};
+        point const q{1, 2};
+        point const r{1, 3};
+        check(fields_equal_to{}(p, q) && !fields_equal_to{}(p, r), "fields_equal_to compares unpadded objects");
+        check(fields_hash{}(p) == fields_hash{}(q), "fields_hash gives equal hashes to equal unpadded objects");
+        check(fields_hash{}(p) != fields_hash{}(r), "fields_hash distinguishes unpadded objects");
+
+        // Padding bytes with different contents must not affect the comparison or the hash
+        with_padding a;
+        with_padding b;
+        std::memset(&a, 0x00, sizeof(a));
+        std::memset(&b, 0xff, sizeof(b));
+        a.c = b.c = 'x';
+        a.i = b.i = 42;
+        check(fields_equal_to{}(a, b), "fields_equal_to ignores padding");
+        check(fields_hash{}(a) == fields_hash{}(b), "fields_hash ignores padding");
+        b.i = 43;
+        check(!fields_equal_to{}(a, b), "fields_equal_to compares padded objects");
+    }
+
+    runtime_test const reflect_runtime{reflect_tests};
+}
@@ -0,0 +1,127 @@
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <fun.hpp>
+#include "tests.hpp"
+
+namespace fun::tests
+{
+    struct header
+    {
+        int id;
+        short flags;
+        short kind;
+        double price;
+    };
+
+    struct message
+    {
+        int id;
+        std::string text;
+        std::vector<short> values;
+    };
+
+    class secret
+    {
+        int _key = 1;
+        int _value = 2;
+
+    public:
+        constexpr int sum() const noexcept
+        {
+            return _key + _value;
+        }
+    };
+
+    using header_serializer = serializer<&header::id, &header::flags, &header::kind, &header::price>;
+    using message_serializer = serializer<&message::id, &message::text, &message::values>;
+
+    static_assert(std::is_same_v<header_serializer::value_type, header>);
+    static_assert(header_serializer::is_fixed_size);
+    static_assert(message_serializer::is_fixed_size == false);
+
+    // Serialized objects contain no padding, and ranges are prefixed by their length
+    static_assert(header_serializer::size(header{}) == sizeof(int) + 2 * sizeof(short) + sizeof(double));
+    static_assert(message_serializer::size(message{1, "abc", {1, 2}}) == sizeof(int) + 2 * 8 + 3 + 2 * sizeof(short));
+
+    template<auto... Ptrs>
+    concept has_serializer = requires { typename serializer<Ptrs ...>; };
+
+    struct unsupported
+    {
+        std::string text;
+        std::vector<std::string> texts;
+    };
+
+    static_assert(has_serializer<&unsupported::text>);
+    static_assert(has_serializer<&unsupported::texts> == false);
+    static_assert(has_serializer<&header::id, &message::id> == false);
+}
+
+// Private members become serializable through an explicit instantiation
+template struct fun::serializable<fun::member_pointers<&fun::tests::secret::_key, &fun::tests::secret::_value>>;
+
+namespace fun::tests
+{
+    static_assert(serializer_of<secret>::is_fixed_size);
+    static_assert(serializer_of<secret>::size(secret{}) == 2 * sizeof(int));
+
+    struct record
+    {
+        int id;
+        short flags;
+        short kind;
+        std::string name;
+        double price;
+        int volume;
+    };
+
+    void serializer_tests()
+    {
+        // The first three members are adjacent and copied as one run, then the name splits the next run
+        using record_serializer = serializer<&record::id, &record::flags, &record::kind, &record::name,
+                                             &record::price, &record::volume>;
+
+        record const original{7, 3, -2, "abcdef", 1.25, 42};
+        std::size_t const expected = sizeof(int) + 2 * sizeof(short) + 8 + 6 + sizeof(double) + sizeof(int);
+        check(record_serializer::size(original) == expected, "serializer computes the size without padding");
+
+        std::byte buffer[64]{};
+        std::size_t const written = record_serializer::serialize(original, buffer);
+        check(written == expected, "serializer writes every member");
+        check(std::memcmp(buffer, &original.id, sizeof(int) + 2 * sizeof(short)) == 0, "serializer copies adjacent members");
+
+        record copy{};
+        std::size_t const read = record_serializer::deserialize(std::span{buffer}.first(written), copy);
+        check(read == written, "serializer reads every member");
+        check(copy.id == 7 && copy.flags == 3 && copy.kind == -2 && copy.name == "abcdef" && copy.price == 1.25
+            && copy.volume == 42, "serializer round-trips an object");
+
+        bool thrown = false;
+        try
+        {
+            static_cast<void>(record_serializer::serialize(original, std::span{buffer}.first(expected - 1)));
+        }
+        catch (std::out_of_range const &)
+        {
+            thrown = true;
+        }
+        check(thrown, "serializer rejects a buffer that is too small");
+
+        thrown = false;
+        try
+        {
+            static_cast<void>(record_serializer::deserialize(std::span{buffer}.first(expected - 1), copy));
+        }
+        catch (std::out_of_range const &)
+        {
+            thrown = true;
+        }
+        check(thrown, "serializer rejects a truncated object");
+    }
+
+    runtime_test const serializer_runtime{serializer_tests};
+}
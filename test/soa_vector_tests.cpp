@@ -0,0 +1,86 @@
+#include <fun.hpp>
+
+namespace fun::tests
+{
+    struct tick
+    {
+        int id = 0;
+        double price = 0.0;
+        int volume = 0;
+        bool flag = false;
+        char venue = 0;
+    };
+
+    using ticks = soa_vector<&tick::id, &tick::price, &tick::volume, &tick::flag>;
+
+    static_assert(std::is_same_v<ticks::value_type, tick>);
+    static_assert(std::is_same_v<decltype(lvalue<ticks>().column<&tick::price>()), std::span<double>>);
+    static_assert(std::is_same_v<decltype(lvalue<ticks const>().column<&tick::id>()), std::span<int const>>);
+    static_assert(std::is_same_v<decltype(lvalue<ticks>()[0].get<&tick::volume>()), int &>);
+    static_assert(std::is_same_v<decltype(lvalue<ticks const>()[0].get<&tick::volume>()), int const &>);
+
+    // Boolean columns are stored a byte at a time, so rows still refer to plain bools
+    static_assert(std::is_same_v<decltype(lvalue<ticks>().column<&tick::flag>()), std::span<boolean>>);
+    static_assert(std::is_same_v<decltype(lvalue<ticks>()[0].get<&tick::flag>()), bool &>);
+    static_assert(std::is_same_v<decltype(lvalue<ticks const>()[0].get<&tick::flag>()), bool const &>);
+    static_assert(std::is_convertible_v<ticks::reference, ticks::const_reference>);
+    static_assert(std::is_convertible_v<ticks::const_reference, ticks::reference> == false);
+
+    // Only listed members of a single class can be stored
+    template<auto P>
+    concept has_column = requires (ticks t) { t.column<P>(); };
+
+    static_assert(has_column<&tick::price>);
+    static_assert(has_column<&tick::venue> == false);
+
+    constexpr ticks make_ticks()
+    {
+        ticks t;
+        for (int i = 0; i < 10; ++i)
+            t.push_back(tick{i, i * 0.5, i * 10, i % 3 == 0, 'x'});
+        t.emplace_back(10, 5.0, 100, false);
+        return t;
+    }
+
+    static_assert(make_ticks().size() == 11);
+    static_assert(make_ticks()[10].get<&tick::volume>() == 100);
+    static_assert(make_ticks().at(3).load().price == 1.5);
+    static_assert(make_ticks()[3].load().flag && !make_ticks()[4].load().flag);
+    static_assert(make_ticks()[3].load().venue == 0);
+
+    static_assert([] {
+        auto t = make_ticks();
+        int flagged = 0;
+        for (bool const flag : t.column<&tick::flag>())
+            flagged += flag;
+        t[1].get<&tick::flag>() = true;
+        return flagged == 4 && t.column<&tick::flag>()[1] == true;
+    }());
+
+    static_assert([] {
+        auto t = make_ticks();
+        int total = 0;
+        for (int const volume : t.column<&tick::volume>())
+            total += volume;
+        return total == 550;
+    }());
+
+    // Erasing and storing keep all columns in sync
+    static_assert([] {
+        auto t = make_ticks();
+        t.erase(0);
+        t.erase(4);
+        t.pop_back();
+        t[0].store(tick{42, 4.2, 420, true});
+        auto const ids = t.column<&tick::id>();
+        auto const prices = t.column<&tick::price>();
+        return t.size() == 8 && ids[0] == 42 && ids[4] == 6 && prices[4] == 3.0 && t[0].get<&tick::volume>() == 420
+            && t[0].get<&tick::flag>();
+    }());
+
+    static_assert([] {
+        auto t = make_ticks();
+        t.clear();
+        return t.empty() && t.column<&tick::price>().empty();
+    }());
+}
@@ -0,0 +1,90 @@
+#include <fun.hpp>
+
+namespace fun::tests
+{
+    using namespace literals;
+    using namespace std::string_view_literals;
+
+    static_assert(std::is_same_v<decltype("buy"_s), string_tag<"buy">>);
+    static_assert(decltype("buy"_s)::value == "buy");
+    static_assert(std::string_view{"sell"_s} == "sell");
+    static_assert(decltype(""_s)::value.empty());
+
+    inline constexpr auto verb = [](std::string_view str) {
+        return string_match(
+            str,
+            [](string_tag<"buy">) { return 1; },
+            [](string_tag<"sell">) { return 2; },
+            [](string_tag<"cancel">) { return 3; },
+            [](std::string_view) { return 0; }
+        );
+    };
+
+    static_assert(verb("buy") == 1);
+    static_assert(verb("sell") == 2);
+    static_assert(verb("cancel") == 3);
+    static_assert(verb("") == 0);
+    static_assert(verb("bu") == 0);
+    static_assert(verb("buyy") == 0);
+    static_assert(verb("hold") == 0);
+
+    // Keys are also found inside of overload sets
+    inline constexpr auto field = overload(
+        [](decltype("id"_s)) noexcept { return 'i'; },
+        [](decltype("name"_s)) noexcept { return 'n'; },
+        overload(
+            [](decltype("price"_s)) noexcept { return 'p'; },
+            [](decltype(""_s)) noexcept { return 'e'; }
+        ),
+        [](auto) noexcept { return '?'; }
+    );
+
+    static_assert(string_match("id", field) == 'i');
+    static_assert(string_match("name", field) == 'n');
+    static_assert(string_match("price", field) == 'p');
+    static_assert(string_match("", field) == 'e');
+    static_assert(string_match("size", field) == '?');
+
+    // Keys are taken from the single parameter of any call operator, including ref-qualified ones
+    struct qualified_matcher
+    {
+        constexpr int operator()(decltype("qualified"_s)) const & noexcept { return 4; }
+    };
+
+    inline constexpr auto binary = [](decltype("binary"_s), int) { return 0; };
+
+    static_assert(std::is_same_v<detail::matcher_key_t<qualified_matcher>, decltype("qualified"_s)>);
+    static_assert(std::is_same_v<detail::matcher_key_t<decltype(binary)>, void>);
+    static_assert(string_match("qualified", qualified_matcher{}, [](std::string_view) { return 0; }) == 4);
+    static_assert(string_match("other", qualified_matcher{}, [](std::string_view) { return 0; }) == 0);
+
+    // Many keys still get distinct slots
+    template<std::size_t... Indices>
+    constexpr bool match_numbers(std::index_sequence<Indices ...>)
+    {
+        constexpr std::string_view names[] = {
+            "zero", "one", "two", "three", "four", "five", "six", "seven",
+            "eight", "nine", "ten", "eleven", "twelve", "thirteen", "fourteen", "fifteen"
+        };
+        auto const number = [](std::string_view str) {
+            return string_match(
+                str,
+                [](decltype("zero"_s)) { return 0; }, [](decltype("one"_s)) { return 1; },
+                [](decltype("two"_s)) { return 2; }, [](decltype("three"_s)) { return 3; },
+                [](decltype("four"_s)) { return 4; }, [](decltype("five"_s)) { return 5; },
+                [](decltype("six"_s)) { return 6; }, [](decltype("seven"_s)) { return 7; },
+                [](decltype("eight"_s)) { return 8; }, [](decltype("nine"_s)) { return 9; },
+                [](decltype("ten"_s)) { return 10; }, [](decltype("eleven"_s)) { return 11; },
+                [](decltype("twelve"_s)) { return 12; }, [](decltype("thirteen"_s)) { return 13; },
+                [](decltype("fourteen"_s)) { return 14; }, [](decltype("fifteen"_s)) { return 15; },
+                [](std::string_view) { return -1; }
+            );
+        };
+        return ((number(names[Indices]) == static_cast<int>(Indices)) && ...) && number("sixteen") == -1;
+    }
+
+    static_assert(match_numbers(std::make_index_sequence<16>{}));
+
+    static_assert(std::is_same_v<decltype(string_match("buy"sv, [](string_tag<"buy">) {})), void>);
+    static_assert(std::is_same_v<decltype(verb("buy")), int>);
+}
@@ -0,0 +1,31 @@
+#include <fun.hpp>
+
+namespace fun::tests
+{
+    using namespace literals;
+
+    inline constexpr auto squares = tabulate<-4, 4>([](std::intmax_t x) { return x * x; });
+    inline constexpr auto parities = tabulate<0, 9>([]<std::intmax_t I>(tag<I>) { return I % 2 == 0; });
+    inline constexpr auto names = tabulate<1, 3>(overload(
+        [](tag<1>) { return "one"; },
+        [](tag<2>) { return "two"; },
+        [](auto) { return "many"; }
+    ));
+
+    static_assert(squares(-4) == 16);
+    static_assert(squares(0) == 0);
+    static_assert(squares(3u) == 9);
+    static_assert(squares(4_t) == 16);
+    static_assert(parities(0) && !parities(7) && parities(8));
+    static_assert(names(1)[0] == 'o' && names(2)[0] == 't' && names(3)[0] == 'm');
+
+    static_assert(squares.table().size() == 9);
+    static_assert(std::is_same_v<decltype(squares(0)), std::intmax_t const &>);
+    static_assert(std::is_same_v<decltype(names(1)), char const *const &>);
+
+    // Tags outside of the range are rejected at compile time, runtime values are bounds-checked
+    static_assert(std::is_invocable_v<decltype(squares), tag<5>> == false);
+    static_assert(std::is_invocable_v<decltype(squares), double> == false);
+    static_assert(noexcept(squares(1_t)));
+    static_assert(!noexcept(squares(1)));
+}
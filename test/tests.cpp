@@ -1,6 +1,12 @@
 #include <iostream>
+#include "tests.hpp"
 
 int main()
 {
-    std::cout << "All compile-time tests were successful.\n";
-}
\ No newline at end of file
+    for (auto const test : fun::tests::runtime_tests())
+        test();
+
+    if (fun::tests::failures > 0)
+        return 1;
+    std::cout << "All tests were successful.\n";
+}
@@ -0,0 +1,39 @@
+#ifndef FUN_TESTS_HPP
+#define FUN_TESTS_HPP
+
+#include <iostream>
+#include <string_view>
+#include <vector>
+
+namespace fun::tests
+{
+    // Number of runtime checks that failed, reported by the main function of the test suite
+    inline int failures = 0;
+
+    // Runtime checks cover the code paths that cannot run in constant expressions
+    inline void check(bool condition, std::string_view description)
+    {
+        if (!condition)
+        {
+            std::cerr << "Failed: " << description << '\n';
+            ++failures;
+        }
+    }
+
+    // Kept in a function, so that test files can register their functions during static initialization
+    [[nodiscard]] inline std::vector<void (*)()> &runtime_tests()
+    {
+        static std::vector<void (*)()> tests;
+        return tests;
+    }
+
+    // Registers a function of runtime checks, which is run by the main function of the test suite
+    struct runtime_test
+    {
+        explicit runtime_test(void (*test)())
+        {
+            runtime_tests().push_back(test);
+        }
+    };
+}
+#endif //FUN_TESTS_HPP
@@ -51,4 +51,42 @@ namespace fun::tests
     static_assert(traits::callable_with_arity<overloaded_callable, 3> == false);
     // This will fail because calling overloaded_callable with one argument is ambiguous
     static_assert(traits::callable_with_arity<overloaded_callable, 1> == false);
-}
\ No newline at end of file
+
+    static_assert(traits::call_arity_v<void()> == 0);
+    static_assert(traits::call_arity_v<int(*)(int, double)> == 2);
+    static_assert(traits::call_arity_v<int(&)(int) noexcept> == 1);
+    static_assert(traits::call_arity_v<callable_with_args<>> == 0);
+    static_assert(traits::call_arity_v<callable_with_args<int, std::string_view> const &> == 2);
+    static_assert(traits::call_arity_v<decltype([](int) mutable noexcept {})> == 1);
+
+    static_assert(traits::call_arity_v<void(...)> == traits::unknown_arity);
+    static_assert(traits::call_arity_v<overloaded_callable> == traits::unknown_arity);
+    static_assert(traits::call_arity_v<decltype([](auto) {})> == traits::unknown_arity);
+    static_assert(traits::call_arity_v<not_callabe> == traits::unknown_arity);
+
+    using summed = traits::signature_of<int(*)(int, double) noexcept>;
+    static_assert(summed::known && summed::arity == 2 && summed::is_noexcept);
+    static_assert(std::is_same_v<summed::type, int(int, double)>);
+    static_assert(std::is_same_v<summed::parameters, std::tuple<int, double>>);
+    static_assert(std::is_same_v<summed::parameter<1>, double>);
+
+    // Qualifiers of the callable are ignored, while those of its call operator are kept
+    using mutable_lambda = decltype([](std::string_view &&) mutable { return 1; });
+    static_assert(std::is_same_v<traits::signature_of<mutable_lambda const &>, traits::signature_of<mutable_lambda>>);
+    static_assert(std::is_same_v<traits::signature_of<mutable_lambda>::result_type, int>);
+    static_assert(std::is_same_v<traits::signature_of<mutable_lambda>::parameter<0>, std::string_view &&>);
+
+    struct counter
+    {
+        int count;
+        int operator()(int step) { return count += step; }
+    };
+
+    static_assert(!traits::signature_of<counter>::const_invocable);
+    static_assert(traits::callable_with_arity<counter, 1> && !traits::callable_with_arity<counter const &, 1>);
+
+    static_assert(!traits::signature_of<overloaded_callable>::known);
+    static_assert(!traits::signature_of<decltype([](auto) {})>::known);
+    static_assert(!traits::signature_of<void(...)>::known);
+    static_assert(!traits::signature_of<not_callabe>::known);
+}
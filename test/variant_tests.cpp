@@ -0,0 +1,162 @@
+#include <string>
+#include <variant>
+#include <vector>
+#include <fun.hpp>
+#include "tests.hpp"
+
+namespace fun::tests
+{
+    struct alignas(8) node { int value; };
+    struct alignas(8) leaf { double weight; };
+    struct alignas(2) pair { char first, second; };
+    struct rgb { unsigned char r, g, b; };
+
+    // The index only takes a single byte, without padding beyond the alignment of the alternatives
+    static_assert(sizeof(variant<char, bool>) == 2);
+    static_assert(sizeof(variant<int, float>) == 8);
+    static_assert(sizeof(variant<rgb, char>) == 4);
+    static_assert(sizeof(variant<std::string, int>) == sizeof(std::string) + alignof(std::string));
+    static_assert(variant<int, float>::is_packed == false);
+
+    // Pointers to aligned types keep the index in their low bits
+    static_assert(sizeof(variant<node *, leaf const *>) == sizeof(void *));
+    static_assert(sizeof(variant<node *, leaf *, std::uint64_t *, double *>) == sizeof(void *));
+    static_assert(variant<node *, leaf *>::is_packed);
+    static_assert(variant<pair *, node *, leaf *>::is_packed == false);
+    static_assert(sizeof(variant<pair *, node *, leaf *>) == 2 * sizeof(void *));
+
+    // Alternatives are only constructed in place from compatible arguments
+    using tagged = variant<node *, leaf const *>;
+    static_assert(std::is_constructible_v<tagged, std::in_place_index_t<1>, leaf *>);
+    static_assert(!std::is_constructible_v<tagged, std::in_place_index_t<0>, double *>);
+    static_assert(!std::is_constructible_v<tagged, std::in_place_index_t<0>, leaf *>);
+    static_assert(!std::is_constructible_v<tagged, std::in_place_type_t<node *>, node const *>);
+    template<typename Variant, std::size_t I, typename... Args>
+    concept emplaceable = requires (Variant v, Args &&... args) { v.template emplace<I>(std::forward<Args>(args) ...); };
+
+    static_assert(emplaceable<tagged, 0, node *>);
+    static_assert(!emplaceable<tagged, 0, double *>);
+    static_assert(!emplaceable<variant<std::string, int>, 1, char const *>);
+
+    // Doubles share their NaN bits with alternatives of up to 4 bytes
+    static_assert(sizeof(variant<double, int, bool>) == 8);
+    static_assert(sizeof(variant<double, float, pair, char16_t>) == 8);
+    static_assert(sizeof(std::variant<double, int, bool>) == 16);
+    static_assert(variant<double, int>::is_packed);
+    static_assert(variant<double, long long>::is_packed == false);
+
+    static_assert(std::is_trivially_copyable_v<variant<int, float>>);
+    static_assert(std::is_trivially_copyable_v<variant<double, int>>);
+    static_assert(std::is_trivially_copyable_v<variant<std::string, int>> == false);
+    static_assert(std::is_copy_constructible_v<variant<std::string, int>>);
+    static_assert(std::variant_size_v<variant<int, char, bool>> == 3);
+    static_assert(std::is_same_v<std::variant_alternative_t<1, variant<int, char, bool>>, char>);
+
+    // Unpacked variants give references to their alternatives, packed ones give values
+    static_assert(std::is_same_v<decltype(get<int>(lvalue<variant<int, float>>())), int &>);
+    static_assert(std::is_same_v<decltype(get<int>(lvalue<variant<int, float> const>())), int const &>);
+    static_assert(std::is_same_v<decltype(get<int>(rvalue<variant<int, float>>())), int &&>);
+    static_assert(std::is_same_v<decltype(get<int>(lvalue<variant<double, int>>())), int>);
+    static_assert(std::is_same_v<decltype(get<node *>(lvalue<variant<node *, leaf *>>())), node *>);
+
+    static_assert(variant<int, float>{}.index() == 0);
+    static_assert(variant<int, float>{2.5f}.index() == 1);
+    static_assert(get<float>(variant<int, float>{2.5f}) == 2.5f);
+    static_assert(variant<int, float>{std::in_place_index<1>, 3}.index() == 1);
+    static_assert(holds_alternative<float>(variant<int, float>{std::in_place_type<float>, 1}));
+    static_assert(variant<int, float>{1} == variant<int, float>{1});
+    static_assert(variant<int, float>{1} != variant<int, float>{1.0f});
+
+    static_assert(variant<double, int, bool>{}.index() == 0);
+    static_assert(variant<double, int, bool>{-7}.index() == 1);
+    static_assert(get<int>(variant<double, int, bool>{-7}) == -7);
+    static_assert(get<bool>(variant<double, int, bool>{true}));
+    static_assert(get<double>(variant<double, int, bool>{-0.5}) == -0.5);
+    static_assert(get<pair>(variant<double, pair>{pair{1, 2}}).second == 2);
+    static_assert(get<rgb>(variant<double, rgb>{rgb{1, 2, 3}}).b == 3);
+
+    // NaNs of any sign are stored as a single canonical NaN, so they never look like another alternative
+    static_assert([] {
+        variant<double, int> v{-std::numeric_limits<double>::quiet_NaN()};
+        double const d = get<double>(v);
+        return v.index() == 0 && d != d;
+    }());
+    static_assert(variant<double, int>{-std::numeric_limits<double>::infinity()}.index() == 0);
+
+    static_assert([] {
+        variant<std::string, int> v{std::string{"long enough to allocate on the heap"}};
+        auto copy = v;
+        v = 5;
+        copy.emplace<std::string>(3, 'x');
+        variant<std::string, int> moved = std::move(copy);
+        return get<int>(v) == 5 && get<std::string>(moved) == "xxx";
+    }());
+
+    static_assert([] {
+        variant<double, int> v{1.5};
+        v = 3;
+        v.emplace<double>(2.0);
+        return get<double>(v) == 2.0;
+    }());
+
+    // Matching works the same as for std::variant, also together with it
+    inline constexpr auto kind = overload(
+        [](int) { return 'i'; },
+        [](double) { return 'd'; },
+        [](bool) { return 'b'; }
+    );
+
+    static_assert(match(variant<double, int, bool>{1}, kind) == 'i');
+    static_assert(match(variant<double, int, bool>{false}, kind) == 'b');
+    static_assert(match(variant<std::string, int>{std::string{"abc"}}, [](std::string const &s) { return s.size(); }, [](int) { return std::size_t{0}; }) == 3);
+    static_assert(match(
+        variant<int, double>{1.0},
+        std::variant<int, bool>{true},
+        [](double, bool) { return 1; },
+        [](auto, auto) { return 0; }
+    ) == 1);
+
+    static_assert([] {
+        variant<int, float> v{1};
+        match(v, [](int &x) { x = 42; }, [](float &) {});
+        return get<int>(v) == 42;
+    }());
+
+    static_assert(match_all<match_mode::ordered>(
+        std::vector<variant<double, int, bool>>{1, 2.0, true, 3},
+        kind
+    ) == std::vector{'i', 'd', 'b', 'i'});
+
+    void tagged_pointer_variant_tests()
+    {
+        node n{1};
+        leaf const l{2.0};
+        tagged v = &n;
+        check(v.index() == 0 && get<0>(v) == &n, "tagged pointer stores the first alternative");
+
+        v = &l;
+        check(v.index() == 1 && get<leaf const *>(v) == &l, "tagged pointer stores the second alternative");
+        check(holds_alternative<leaf const *>(v) && !holds_alternative<node *>(v), "tagged pointer reports its alternative");
+
+        bool thrown = false;
+        try
+        {
+            static_cast<void>(get<0>(v));
+        }
+        catch (std::bad_variant_access const &)
+        {
+            thrown = true;
+        }
+        check(thrown, "tagged pointer throws on access to the inactive alternative");
+
+        v.emplace<0>(&n);
+        check(v.index() == 0 && v == tagged{&n}, "tagged pointer emplaces in place");
+
+        auto const value = [](tagged const &var) {
+            return match(var, [](node *p) { return p->value; }, [](leaf const *p) { return static_cast<int>(-p->weight); });
+        };
+        check(value(v) == 1 && value(tagged{&l}) == -2, "tagged pointer is matched");
+    }
+
+    runtime_test const tagged_pointer_variant_runtime{tagged_pointer_variant_tests};
+}